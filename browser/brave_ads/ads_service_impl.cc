@@ -544,6 +544,12 @@ std::string AdsServiceImpl::GetAutoDetectedAdsSubdivisionTargetingCode() const {
 ///////////////////////////////////////////////////////////////////////////////
 
 void AdsServiceImpl::Shutdown() {
+  // |is_initialized_| is cleared once bat ads has replied to |Shutdown|, so
+  // this is only true if ads was not shut down through |ShutdownBatAds| or
+  // |ResetAllState|, i.e. when the profile is destroyed
+  const bool should_shutdown_bat_ads =
+      is_initialized_ && bat_ads_.is_connected();
+
   is_initialized_ = false;
 
   BackgroundHelper::GetInstance()->RemoveObserver(this);
@@ -554,15 +560,33 @@ void AdsServiceImpl::Shutdown() {
 
   idle_poll_timer_.Stop();
 
-  bat_ads_.reset();
-  bat_ads_client_receiver_.reset();
-  bat_ads_service_.reset();
+  if (should_shutdown_bat_ads) {
+    // Bat ads saves pending client state through |bat_ads_client_receiver_|
+    // before replying, so keep it bound until then. If |this| is destroyed
+    // first the receiver is released with it
+    bat_ads_->Shutdown(
+        base::BindOnce(&AdsServiceImpl::OnShutdownBatAdsAndFlush, AsWeakPtr()));
+  } else {
+    ResetBatAds();
+  }
 
   const bool success =
       file_task_runner_->DeleteSoon(FROM_HERE, database_.release());
   VLOG_IF(1, !success) << "Failed to release database";
 }
 
+void AdsServiceImpl::OnShutdownBatAdsAndFlush(const bool success) {
+  VLOG_IF(0, !success) << "Failed to flush ads state";
+
+  ResetBatAds();
+}
+
+void AdsServiceImpl::ResetBatAds() {
+  bat_ads_.reset();
+  bat_ads_client_receiver_.reset();
+  bat_ads_service_.reset();
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 bool MigrateConfirmationsStateOnFileTaskRunner(const base::FilePath& path) {
@@ -708,6 +732,9 @@ void AdsServiceImpl::OnShutdownBatAds(const bool success) {
     return;
   }
 
+  // Bat ads has already flushed its state
+  is_initialized_ = false;
+
   Shutdown();
 
   VLOG(1) << "Successfully shutdown ads";
@@ -812,6 +839,9 @@ void AdsServiceImpl::OnShutdownAndResetBatAds(const bool success) {
     return;
   }
 
+  // Bat ads has already flushed its state
+  is_initialized_ = false;
+
   Shutdown();
 
   VLOG(1) << "Successfully shutdown ads";
@@ -209,6 +209,9 @@ class AdsServiceImpl : public AdsService,
 
   void OnInitialize(const bool success);
 
+  void OnShutdownBatAdsAndFlush(const bool success);
+  void ResetBatAds();
+
   void ShutdownBatAds();
   void OnShutdownBatAds(const bool success);
 
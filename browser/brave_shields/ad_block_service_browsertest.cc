@@ -362,6 +362,39 @@ IN_PROC_BROWSER_TEST_F(AdBlockServiceTest, AdsGetBlockedByCustomBlocker) {
   EXPECT_EQ(browser()->profile()->GetPrefs()->GetUint64(kAdsBlocked), 1ULL);
 }
 
+// Load a page with an ad image blocked by custom filters, then remove the
+// filter and make sure the same ad image is no longer blocked, i.e. that
+// cached matching results do not outlive an engine update.
+IN_PROC_BROWSER_TEST_F(AdBlockServiceTest,
+                       CustomFiltersUpdateInvalidatesCachedResults) {
+  ASSERT_TRUE(InstallDefaultAdBlockExtension());
+  EXPECT_EQ(browser()->profile()->GetPrefs()->GetUint64(kAdsBlocked), 0ULL);
+
+  UpdateAdBlockInstanceWithRules("");
+
+  UpdateCustomAdBlockInstanceWithRules("*ad_banner.png");
+
+  GURL url = embedded_test_server()->GetURL(kAdBlockTestPage);
+  ASSERT_TRUE(ui_test_utils::NavigateToURL(browser(), url));
+  content::WebContents* contents =
+      browser()->tab_strip_model()->GetActiveWebContents();
+
+  EXPECT_EQ(true, EvalJs(contents,
+                         "setExpectations(0, 1, 0, 0);"
+                         "addImage('ad_banner.png')"));
+  EXPECT_EQ(browser()->profile()->GetPrefs()->GetUint64(kAdsBlocked), 1ULL);
+
+  UpdateCustomAdBlockInstanceWithRules("");
+
+  ASSERT_TRUE(ui_test_utils::NavigateToURL(browser(), url));
+  contents = browser()->tab_strip_model()->GetActiveWebContents();
+
+  EXPECT_EQ(true, EvalJs(contents,
+                         "setExpectations(1, 0, 0, 0);"
+                         "addImage('ad_banner.png')"));
+  EXPECT_EQ(browser()->profile()->GetPrefs()->GetUint64(kAdsBlocked), 1ULL);
+}
+
 // Load a page with an ad image, with a corresponding exception installed in
 // the custom filters, and make sure it is not blocked.
 IN_PROC_BROWSER_TEST_F(AdBlockServiceTest, DefaultBlockCustomException) {
@@ -1018,12 +1051,14 @@ IN_PROC_BROWSER_TEST_F(AdBlockServiceTest,
 
   // XHR request to an unblocked first-party endpoint that is CNAME cloaked.
   // The canonical alias has no matching rule, so the request should be allowed.
+  // The canonical name of a.com was already resolved for the root document, so
+  // the resolver should not be queried again.
   ASSERT_EQ(true, EvalJs(contents,
                          base::StringPrintf("setExpectations(0, 1, 1, 1);"
                                             "xhr('%s')",
                                             safe_resource_url.spec().c_str())));
   EXPECT_EQ(browser()->profile()->GetPrefs()->GetUint64(kAdsBlocked), 2ULL);
-  ASSERT_EQ(4ULL, inner_resolver->num_resolve());
+  ASSERT_EQ(3ULL, inner_resolver->num_resolve());
 
   // XHR request directly to a blocked third-party endpoint.
   // The resolver should not be queried for this request.
@@ -1032,7 +1067,7 @@ IN_PROC_BROWSER_TEST_F(AdBlockServiceTest,
                                             "xhr('%s')",
                                             bad_resource_url.spec().c_str())));
   EXPECT_EQ(browser()->profile()->GetPrefs()->GetUint64(kAdsBlocked), 3ULL);
-  ASSERT_EQ(4ULL, inner_resolver->num_resolve());
+  ASSERT_EQ(3ULL, inner_resolver->num_resolve());
 
   // Unset the host resolver so as not to interfere with later tests.
   brave::SetAdblockCnameHostResolverForTesting(nullptr);
@@ -1106,12 +1141,14 @@ IN_PROC_BROWSER_TEST_F(AdBlockServiceTest,
 
   // XHR request to an unblocked first-party endpoint that is CNAME cloaked.
   // The canonical alias has no matching rule, so the request should be allowed.
+  // The canonical name of a.com was already resolved for the root document, so
+  // the resolver should not be queried again.
   ASSERT_EQ(true, EvalJs(contents,
                          base::StringPrintf("setExpectations(0, 1, 1, 1);"
                                             "xhr('%s')",
                                             safe_resource_url.spec().c_str())));
   EXPECT_EQ(browser()->profile()->GetPrefs()->GetUint64(kAdsBlocked), 2ULL);
-  ASSERT_EQ(4ULL, inner_resolver->num_resolve());
+  ASSERT_EQ(3ULL, inner_resolver->num_resolve());
 
   // XHR request directly to a blocked third-party endpoint.
   // The resolver should not be queried for this request.
@@ -1120,7 +1157,7 @@ IN_PROC_BROWSER_TEST_F(AdBlockServiceTest,
                                             "xhr('%s')",
                                             bad_resource_url.spec().c_str())));
   EXPECT_EQ(browser()->profile()->GetPrefs()->GetUint64(kAdsBlocked), 3ULL);
-  ASSERT_EQ(4ULL, inner_resolver->num_resolve());
+  ASSERT_EQ(3ULL, inner_resolver->num_resolve());
 
   // Unset the host resolver so as not to interfere with later tests.
   brave::SetAdblockCnameHostResolverForTesting(nullptr);
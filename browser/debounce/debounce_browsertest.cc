@@ -138,6 +138,12 @@ class DebounceBrowserTest : public BaseLocalDataFilesBrowserTest {
     return original_url.ReplaceComponents(replacement);
   }
 
+  GURL add_generic_redirect_param(const GURL& original_url,
+                                  const GURL& landing_url) {
+    return net::AppendOrReplaceQueryParameter(original_url, "generic",
+                                              landing_url.spec());
+  }
+
   content::WebContents* web_contents() {
     return browser()->tab_strip_model()->GetActiveWebContents();
   }
@@ -251,6 +257,33 @@ IN_PROC_BROWSER_TEST_F(DebounceBrowserTest, NotDoubleRedirect) {
   NavigateToURLAndWaitForRedirects(start_url, intermediate_url);
 }
 
+// Test a redirect chain across sites which goes through a rule that is not
+// tied to any site. After each redirect, the rules for the new site are picked
+// up after the rule which just applied.
+IN_PROC_BROWSER_TEST_F(DebounceBrowserTest, CrossSiteRedirectThroughAnyHost) {
+  ASSERT_TRUE(InstallMockExtension());
+  GURL url_z = embedded_test_server()->GetURL("z.com", "/");
+  GURL url_j = add_redirect_param(
+      embedded_test_server()->GetURL("chain.j.com", "/"), url_z);
+  GURL url_k = add_generic_redirect_param(
+      embedded_test_server()->GetURL("any.k.com", "/"), url_j);
+  GURL url_i = add_redirect_param(
+      embedded_test_server()->GetURL("chain.i.com", "/"), url_k);
+  NavigateToURLAndWaitForRedirects(url_i, url_z);
+}
+
+// Test that a rule which is not tied to any site is not reapplied after a
+// later rule redirects to another site.
+IN_PROC_BROWSER_TEST_F(DebounceBrowserTest, NotDoubleRedirectThroughAnyHost) {
+  ASSERT_TRUE(InstallMockExtension());
+  GURL url_z = embedded_test_server()->GetURL("z.com", "/");
+  GURL url_k = add_generic_redirect_param(
+      embedded_test_server()->GetURL("any.k.com", "/"), url_z);
+  GURL url_j = add_redirect_param(
+      embedded_test_server()->GetURL("chain.j.com", "/"), url_k);
+  NavigateToURLAndWaitForRedirects(url_j, url_k);
+}
+
 // Test wildcard URL patterns by constructing a URL that should be
 // debounced because it matches a wildcard include pattern.
 IN_PROC_BROWSER_TEST_F(DebounceBrowserTest, WildcardInclude) {
@@ -5,12 +5,15 @@
 
 #include "brave/browser/net/brave_ad_block_tp_network_delegate_helper.h"
 
+#include <map>
 #include <memory>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
 #include "base/base64url.h"
+#include "base/containers/lru_cache.h"
 #include "base/feature_list.h"
 #include "base/metrics/histogram_macros.h"
 #include "base/no_destructor.h"
@@ -51,6 +54,55 @@ namespace brave {
 
 namespace {
 
+// Canonical names are only reused for a short time, as the resolver's own
+// cache is responsible for honoring DNS TTLs.
+constexpr base::TimeDelta kCanonicalNameCacheTtl = base::Minutes(1);
+constexpr size_t kMaxCanonicalNameCacheSize = 1000;
+
+using CanonicalNameCallback =
+    base::OnceCallback<void(absl::optional<std::string>)>;
+
+// <browser_context_id, network_isolation_key, host>
+using CanonicalNameKey =
+    std::tuple<std::string, net::NetworkIsolationKey, std::string>;
+
+struct CanonicalNameEntry {
+  std::string canonical_name;
+  base::TimeTicks expire_time;
+};
+
+// A request waiting for a resolution which is in flight.
+struct PendingCanonicalNameRequest {
+  PendingCanonicalNameRequest(std::shared_ptr<BraveRequestInfo> ctx,
+                              CanonicalNameCallback callback)
+      : ctx(std::move(ctx)), callback(std::move(callback)) {}
+  PendingCanonicalNameRequest(PendingCanonicalNameRequest&&) = default;
+  PendingCanonicalNameRequest& operator=(PendingCanonicalNameRequest&&) =
+      default;
+  ~PendingCanonicalNameRequest() = default;
+
+  std::shared_ptr<BraveRequestInfo> ctx;
+  CanonicalNameCallback callback;
+};
+
+// Only accessed on the UI thread.
+base::LRUCache<CanonicalNameKey, CanonicalNameEntry>& GetCanonicalNameCache() {
+  static base::NoDestructor<
+      base::LRUCache<CanonicalNameKey, CanonicalNameEntry>>
+      cache(kMaxCanonicalNameCacheSize);
+  return *cache;
+}
+
+// Only accessed on the UI thread. Entries are removed once their resolution
+// completes, so this is bounded by the number of requests in flight.
+std::map<CanonicalNameKey, std::vector<PendingCanonicalNameRequest>>&
+GetPendingCanonicalNameRequests() {
+  static base::NoDestructor<
+      std::map<CanonicalNameKey, std::vector<PendingCanonicalNameRequest>>>
+      pending_requests;
+  return *pending_requests;
+}
+
 const std::string& GetCanonicalName(
     const std::vector<std::string>& dns_aliases) {
   return dns_aliases.size() >= 1 ? dns_aliases.front() : base::EmptyString();
@@ -63,6 +115,9 @@ network::HostResolver* g_testing_host_resolver;
 void SetAdblockCnameHostResolverForTesting(
     network::HostResolver* host_resolver) {
   g_testing_host_resolver = host_resolver;
+  // Canonical names from a previous resolver must not leak into later tests.
+  GetCanonicalNameCache().Clear();
+  GetPendingCanonicalNameRequests().clear();
 }
 
 // Used to keep track of state between a primary adblock engine query and one
@@ -79,22 +134,20 @@ void UseCnameResult(scoped_refptr<base::SequencedTaskRunner> task_runner,
                     EngineFlags previous_result,
                     absl::optional<std::string> cname);
 
+// Resolves the canonical name for a host and passes it to every request that
+// is waiting on the corresponding pending entry.
 class AdblockCnameResolveHostClient : public network::mojom::ResolveHostClient {
  private:
   mojo::Receiver<network::mojom::ResolveHostClient> receiver_{this};
-  base::OnceCallback<void(absl::optional<std::string>)> cb_;
+  CanonicalNameKey key_;
   base::TimeTicks start_time_;
 
  public:
-  AdblockCnameResolveHostClient(
-      const ResponseCallback& next_callback,
-      scoped_refptr<base::SequencedTaskRunner> task_runner,
-      std::shared_ptr<BraveRequestInfo> ctx,
-      EngineFlags previous_result) {
+  AdblockCnameResolveHostClient(const CanonicalNameKey& key,
+                                std::shared_ptr<BraveRequestInfo> ctx,
+                                network::mojom::NetworkContext* network_context)
+      : key_(key) {
     DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
-    cb_ = base::BindOnce(&UseCnameResult, task_runner, std::move(next_callback),
-                         ctx, previous_result);
-
     const auto network_isolation_key = ctx->network_isolation_key;
 
     network::mojom::ResolveHostParametersPtr optional_parameters =
@@ -117,20 +170,7 @@ class AdblockCnameResolveHostClient : public network::mojom::ResolveHostClient {
           net::HostPortPair::FromURL(ctx->request_url), network_isolation_key,
           std::move(optional_parameters), receiver_.BindNewPipeAndPassRemote());
     } else {
-      auto* web_contents =
-          content::WebContents::FromFrameTreeNodeId(ctx->frame_tree_node_id);
-      if (!web_contents) {
-        start_time_ = base::TimeTicks::Now();
-        this->OnComplete(net::ERR_FAILED, net::ResolveErrorInfo(),
-                         absl::nullopt);
-        return;
-      }
-
-      network::mojom::NetworkContext* network_context =
-          web_contents->GetBrowserContext()
-              ->GetDefaultStoragePartition()
-              ->GetNetworkContext();
-
+      DCHECK(network_context);
       network_context->ResolveHost(
           net::HostPortPair::FromURL(ctx->request_url), network_isolation_key,
           std::move(optional_parameters), receiver_.BindNewPipeAndPassRemote());
@@ -148,14 +188,34 @@ class AdblockCnameResolveHostClient : public network::mojom::ResolveHostClient {
       const absl::optional<net::AddressList>& resolved_addresses) override {
     UMA_HISTOGRAM_TIMES("Brave.ShieldsCNAMEBlocking.TotalResolutionTime",
                         base::TimeTicks::Now() - start_time_);
+    absl::optional<std::string> canonical_name;
     if (result == net::OK && resolved_addresses) {
       DCHECK(resolved_addresses.has_value() && !resolved_addresses->empty());
-      std::move(cb_).Run(absl::optional<std::string>(
-          GetCanonicalName(resolved_addresses.value().dns_aliases())));
-    } else {
-      std::move(cb_).Run(absl::nullopt);
+      canonical_name =
+          GetCanonicalName(resolved_addresses.value().dns_aliases());
     }
 
+    std::vector<PendingCanonicalNameRequest> requests;
+    auto& pending_requests = GetPendingCanonicalNameRequests();
+    auto it = pending_requests.find(key_);
+    // Pending requests are cleared when the testing resolver changes.
+    if (it != pending_requests.end()) {
+      requests = std::move(it->second);
+      pending_requests.erase(it);
+
+      // Failures may be specific to a request, i.e. a closed tab, so do not
+      // cache them.
+      if (canonical_name) {
+        CanonicalNameEntry entry;
+        entry.canonical_name = *canonical_name;
+        entry.expire_time = base::TimeTicks::Now() + kCanonicalNameCacheTtl;
+        GetCanonicalNameCache().Put(key_, std::move(entry));
+      }
+    }
+
+    for (auto& request : requests)
+      std::move(request.callback).Run(canonical_name);
+
     delete this;
   }
 
@@ -170,6 +230,49 @@ class AdblockCnameResolveHostClient : public network::mojom::ResolveHostClient {
   }
 };
 
+// Starts the resolution for `key` through the network context of the oldest
+// waiting request. A request whose frame has gone away is failed on its own,
+// and the next waiter re-issues the resolution through its own frame.
+void StartCanonicalNameResolution(const CanonicalNameKey& key) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  std::vector<CanonicalNameCallback> failed_callbacks;
+
+  auto& pending_requests = GetPendingCanonicalNameRequests();
+  auto it = pending_requests.find(key);
+  while (it != pending_requests.end()) {
+    DCHECK(!it->second.empty());
+    std::shared_ptr<BraveRequestInfo> ctx = it->second.front().ctx;
+
+    network::mojom::NetworkContext* network_context = nullptr;
+    if (!g_testing_host_resolver) {
+      auto* web_contents =
+          content::WebContents::FromFrameTreeNodeId(ctx->frame_tree_node_id);
+      if (web_contents) {
+        network_context = web_contents->GetBrowserContext()
+                              ->GetDefaultStoragePartition()
+                              ->GetNetworkContext();
+      }
+    }
+
+    if (g_testing_host_resolver || network_context) {
+      // This will be deleted by `AdblockCnameResolveHostClient::OnComplete`.
+      new AdblockCnameResolveHostClient(key, ctx, network_context);
+      break;
+    }
+
+    failed_callbacks.push_back(std::move(it->second.front().callback));
+    it->second.erase(it->second.begin());
+    if (it->second.empty()) {
+      pending_requests.erase(it);
+      it = pending_requests.end();
+    }
+  }
+
+  // Run these last, as they may start new resolutions.
+  for (auto& callback : failed_callbacks)
+    std::move(callback).Run(absl::nullopt);
+}
+
 // If `canonical_url` is specified, this will only check if the CNAME-uncloaked
 // response should be blocked. Otherwise, it will run the check for the
 // original request URL.
@@ -210,6 +313,43 @@ EngineFlags ShouldBlockRequestOnTaskRunner(
   return previous_result;
 }
 
+// Runs `callback` with the canonical name of the request host, sharing a
+// recent or in flight resolution of the same host for the same browser context
+// and network isolation key.
+void ResolveCanonicalName(std::shared_ptr<BraveRequestInfo> ctx,
+                          CanonicalNameCallback callback) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  DCHECK(ctx->browser_context);
+  const CanonicalNameKey key(ctx->browser_context->UniqueId(),
+                             ctx->network_isolation_key,
+                             ctx->request_url.host());
+
+  auto& cache = GetCanonicalNameCache();
+  auto it = cache.Get(key);
+  if (it != cache.end()) {
+    if (it->second.expire_time > base::TimeTicks::Now()) {
+      UMA_HISTOGRAM_BOOLEAN("Brave.ShieldsCNAMEBlocking.ResolutionReused",
+                            true);
+      std::move(callback).Run(it->second.canonical_name);
+      return;
+    }
+
+    cache.Erase(it);
+  }
+
+  auto& pending_requests = GetPendingCanonicalNameRequests();
+  auto pending_it = pending_requests.find(key);
+  if (pending_it != pending_requests.end()) {
+    UMA_HISTOGRAM_BOOLEAN("Brave.ShieldsCNAMEBlocking.ResolutionReused", true);
+    pending_it->second.emplace_back(ctx, std::move(callback));
+    return;
+  }
+
+  UMA_HISTOGRAM_BOOLEAN("Brave.ShieldsCNAMEBlocking.ResolutionReused", false);
+  pending_requests[key].emplace_back(ctx, std::move(callback));
+  StartCanonicalNameResolution(key);
+}
+
 void OnShouldBlockRequestResult(
     bool then_check_uncloaked,
     scoped_refptr<base::SequencedTaskRunner> task_runner,
@@ -221,9 +361,8 @@ void OnShouldBlockRequestResult(
     brave_shields::BraveShieldsWebContentsObserver::DispatchBlockedEvent(
         ctx->request_url, ctx->frame_tree_node_id, brave_shields::kAds);
   } else if (then_check_uncloaked) {
-    // This will be deleted by `AdblockCnameResolveHostClient::OnComplete`.
-    new AdblockCnameResolveHostClient(std::move(next_callback), task_runner,
-                                      ctx, result);
+    ResolveCanonicalName(ctx, base::BindOnce(&UseCnameResult, task_runner,
+                                             next_callback, ctx, result));
     return;
   }
   next_callback.Run();
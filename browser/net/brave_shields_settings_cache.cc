@@ -0,0 +1,93 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/brave_shields_settings_cache.h"
+
+#include "base/memory/ptr_util.h"
+#include "brave/components/brave_shields/browser/brave_shields_util.h"
+#include "chrome/browser/content_settings/host_content_settings_map_factory.h"
+#include "chrome/browser/profiles/profile.h"
+#include "content/public/browser/browser_context.h"
+#include "content/public/browser/browser_thread.h"
+
+namespace brave {
+
+namespace {
+
+// User data key for ShieldsSettingsCache.
+const void* const kShieldsSettingsCacheUserDataKey =
+    &kShieldsSettingsCacheUserDataKey;
+
+// Tab origins and redirect sources seen by the request path of a profile.
+constexpr size_t kMaxCacheSize = 100;
+
+}  // namespace
+
+ShieldsSettingsCache::ShieldsSettingsCache(HostContentSettingsMap* map)
+    : map_(map), settings_(kMaxCacheSize) {
+  observation_.Observe(map_.get());
+}
+
+ShieldsSettingsCache::~ShieldsSettingsCache() = default;
+
+// static
+ShieldsSettingsCache* ShieldsSettingsCache::GetForBrowserContext(
+    content::BrowserContext* browser_context) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+
+  auto* self = static_cast<ShieldsSettingsCache*>(
+      browser_context->GetUserData(kShieldsSettingsCacheUserDataKey));
+  if (!self) {
+    auto* map = HostContentSettingsMapFactory::GetForProfile(
+        Profile::FromBrowserContext(browser_context));
+    self = new ShieldsSettingsCache(map);
+    browser_context->SetUserData(kShieldsSettingsCacheUserDataKey,
+                                 base::WrapUnique(self));
+  }
+  return self;
+}
+
+const ShieldsSettings& ShieldsSettingsCache::Get(const GURL& url) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+
+  auto it = settings_.Get(url);
+  if (it != settings_.end())
+    return it->second;
+
+  HostContentSettingsMap* map = map_.get();
+  ShieldsSettings settings;
+  settings.allow_brave_shields =
+      brave_shields::GetBraveShieldsEnabled(map, url);
+  settings.allow_ads = brave_shields::GetAdControlType(map, url) ==
+                       brave_shields::ControlType::ALLOW;
+  // Currently, "aggressive" mode is registered as a cosmetic filtering control
+  // type, even though it can also affect network blocking.
+  settings.aggressive_blocking =
+      brave_shields::GetCosmeticFilteringControlType(map, url) ==
+      brave_shields::ControlType::BLOCK;
+  settings.allow_http_upgradable_resource =
+      !brave_shields::GetHTTPSEverywhereEnabled(map, url);
+  settings.allow_referrers = brave_shields::AllowReferrers(map, url);
+  return settings_.Put(url, settings)->second;
+}
+
+void ShieldsSettingsCache::OnContentSettingChanged(
+    const ContentSettingsPattern& primary_pattern,
+    const ContentSettingsPattern& secondary_pattern,
+    ContentSettingsType content_type) {
+  switch (content_type) {
+    case ContentSettingsType::BRAVE_SHIELDS:
+    case ContentSettingsType::BRAVE_ADS:
+    case ContentSettingsType::BRAVE_COSMETIC_FILTERING:
+    case ContentSettingsType::BRAVE_HTTP_UPGRADABLE_RESOURCES:
+    case ContentSettingsType::BRAVE_REFERRERS:
+      settings_.Clear();
+      break;
+    default:
+      break;
+  }
+}
+
+}  // namespace brave
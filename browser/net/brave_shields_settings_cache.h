@@ -0,0 +1,64 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_BROWSER_NET_BRAVE_SHIELDS_SETTINGS_CACHE_H_
+#define BRAVE_BROWSER_NET_BRAVE_SHIELDS_SETTINGS_CACHE_H_
+
+#include "base/containers/lru_cache.h"
+#include "base/memory/scoped_refptr.h"
+#include "base/scoped_observation.h"
+#include "base/supports_user_data.h"
+#include "components/content_settings/core/browser/content_settings_observer.h"
+#include "components/content_settings/core/browser/host_content_settings_map.h"
+#include "url/gurl.h"
+
+namespace content {
+class BrowserContext;
+}
+
+namespace brave {
+
+// The shields settings which the network delegate helpers need for a request,
+// resolved for one URL.
+struct ShieldsSettings {
+  bool allow_brave_shields = true;
+  bool allow_ads = false;
+  bool aggressive_blocking = false;
+  bool allow_http_upgradable_resource = false;
+  bool allow_referrers = false;
+};
+
+// Caches |ShieldsSettings| per URL so that every request from a tab doesn't
+// match the same content settings patterns again. There is one cache per
+// profile and it is cleared whenever a shields content setting changes.
+class ShieldsSettingsCache : public base::SupportsUserData::Data,
+                             public content_settings::Observer {
+ public:
+  ShieldsSettingsCache(const ShieldsSettingsCache&) = delete;
+  ShieldsSettingsCache& operator=(const ShieldsSettingsCache&) = delete;
+  ~ShieldsSettingsCache() override;
+
+  static ShieldsSettingsCache* GetForBrowserContext(
+      content::BrowserContext* browser_context);
+
+  const ShieldsSettings& Get(const GURL& url);
+
+ private:
+  explicit ShieldsSettingsCache(HostContentSettingsMap* map);
+
+  // content_settings::Observer:
+  void OnContentSettingChanged(const ContentSettingsPattern& primary_pattern,
+                               const ContentSettingsPattern& secondary_pattern,
+                               ContentSettingsType content_type) override;
+
+  scoped_refptr<HostContentSettingsMap> map_;
+  base::LRUCache<GURL, ShieldsSettings> settings_;
+  base::ScopedObservation<HostContentSettingsMap, content_settings::Observer>
+      observation_{this};
+};
+
+}  // namespace brave
+
+#endif  // BRAVE_BROWSER_NET_BRAVE_SHIELDS_SETTINGS_CACHE_H_
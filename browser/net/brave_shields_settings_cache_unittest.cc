@@ -0,0 +1,73 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/brave_shields_settings_cache.h"
+
+#include <memory>
+
+#include "brave/components/brave_shields/browser/brave_shields_util.h"
+#include "chrome/browser/content_settings/host_content_settings_map_factory.h"
+#include "chrome/test/base/testing_profile.h"
+#include "components/content_settings/core/browser/host_content_settings_map.h"
+#include "content/public/test/browser_task_environment.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+namespace brave {
+
+class ShieldsSettingsCacheTest : public testing::Test {
+ public:
+  void SetUp() override {
+    profile_ = std::make_unique<TestingProfile>();
+    map_ = HostContentSettingsMapFactory::GetForProfile(profile_.get());
+  }
+
+  ShieldsSettingsCache* cache() {
+    return ShieldsSettingsCache::GetForBrowserContext(profile_.get());
+  }
+
+  HostContentSettingsMap* map() { return map_.get(); }
+
+ private:
+  content::BrowserTaskEnvironment task_environment_;
+
+  std::unique_ptr<TestingProfile> profile_;
+  scoped_refptr<HostContentSettingsMap> map_;
+};
+
+TEST_F(ShieldsSettingsCacheTest, MatchesContentSettings) {
+  const GURL kBraveURL("https://brave.com/");
+
+  const ShieldsSettings& settings = cache()->Get(kBraveURL);
+  EXPECT_EQ(brave_shields::GetBraveShieldsEnabled(map(), kBraveURL),
+            settings.allow_brave_shields);
+  EXPECT_EQ(brave_shields::GetAdControlType(map(), kBraveURL) ==
+                brave_shields::ControlType::ALLOW,
+            settings.allow_ads);
+  EXPECT_EQ(brave_shields::GetCosmeticFilteringControlType(map(), kBraveURL) ==
+                brave_shields::ControlType::BLOCK,
+            settings.aggressive_blocking);
+  EXPECT_EQ(!brave_shields::GetHTTPSEverywhereEnabled(map(), kBraveURL),
+            settings.allow_http_upgradable_resource);
+  EXPECT_EQ(brave_shields::AllowReferrers(map(), kBraveURL),
+            settings.allow_referrers);
+}
+
+TEST_F(ShieldsSettingsCacheTest, InvalidatedOnShieldsSettingChange) {
+  const GURL kBraveURL("https://brave.com/");
+  const GURL kBatURL("https://basicattentiontoken.org/");
+
+  EXPECT_TRUE(cache()->Get(kBraveURL).allow_brave_shields);
+  EXPECT_TRUE(cache()->Get(kBatURL).allow_brave_shields);
+
+  brave_shields::SetBraveShieldsEnabled(map(), false, kBraveURL);
+  EXPECT_FALSE(cache()->Get(kBraveURL).allow_brave_shields);
+  EXPECT_TRUE(cache()->Get(kBatURL).allow_brave_shields);
+
+  brave_shields::SetBraveShieldsEnabled(map(), true, kBraveURL);
+  EXPECT_TRUE(cache()->Get(kBraveURL).allow_brave_shields);
+}
+
+}  // namespace brave
@@ -9,12 +9,10 @@
 #include <string>
 
 #include "brave/browser/brave_shields/brave_shields_web_contents_observer.h"
-#include "brave/components/brave_shields/browser/brave_shields_util.h"
+#include "brave/browser/net/brave_shields_settings_cache.h"
 #include "brave/components/brave_webtorrent/browser/buildflags/buildflags.h"
 #include "brave/components/brave_webtorrent/browser/webtorrent_util.h"
 #include "brave/components/ipfs/buildflags/buildflags.h"
-#include "chrome/browser/content_settings/host_content_settings_map_factory.h"
-#include "chrome/browser/profiles/profile.h"
 #include "content/public/browser/browser_thread.h"
 #include "content/public/browser/render_frame_host.h"
 #include "net/base/isolation_info.h"
@@ -136,27 +134,23 @@ std::shared_ptr<brave::BraveRequestInfo> BraveRequestInfo::MakeCTX(
   }
 #endif
 
-  Profile* profile = Profile::FromBrowserContext(browser_context);
-  auto* map = HostContentSettingsMapFactory::GetForProfile(profile);
-  ctx->allow_brave_shields =
-      brave_shields::GetBraveShieldsEnabled(map, ctx->tab_origin);
-  ctx->allow_ads = brave_shields::GetAdControlType(map, ctx->tab_origin) ==
-                   brave_shields::ControlType::ALLOW;
-  // Currently, "aggressive" mode is registered as a cosmetic filtering control
-  // type, even though it can also affect network blocking.
-  ctx->aggressive_blocking =
-      brave_shields::GetCosmeticFilteringControlType(map, ctx->tab_origin) ==
-      brave_shields::ControlType::BLOCK;
+  auto* settings_cache =
+      ShieldsSettingsCache::GetForBrowserContext(browser_context);
+  const ShieldsSettings settings = settings_cache->Get(ctx->tab_origin);
+  ctx->allow_brave_shields = settings.allow_brave_shields;
+  ctx->allow_ads = settings.allow_ads;
+  ctx->aggressive_blocking = settings.aggressive_blocking;
   ctx->allow_http_upgradable_resource =
-      !brave_shields::GetHTTPSEverywhereEnabled(map, ctx->tab_origin);
+      settings.allow_http_upgradable_resource;
 
   // HACK: after we fix multiple creations of BraveRequestInfo we should
   // use only tab_origin. Since we recreate BraveRequestInfo during consequent
   // stages of navigation, |tab_origin| changes and so does |allow_referrers|
   // flag, which is not what we want for determining referrers.
-  ctx->allow_referrers = brave_shields::AllowReferrers(
-      map,
-      ctx->redirect_source.is_empty() ? ctx->tab_origin : ctx->redirect_source);
+  ctx->allow_referrers =
+      ctx->redirect_source.is_empty()
+          ? settings.allow_referrers
+          : settings_cache->Get(ctx->redirect_source).allow_referrers;
   ctx->upload_data = GetUploadData(request);
 
   ctx->browser_context = browser_context;
@@ -38,18 +38,24 @@ float ConstantMultiplier(double fudge_factor, float value, size_t index) {
   return value * fudge_factor;
 }
 
-float PseudoRandomSequence(uint64_t seed, float value, size_t index) {
-  static uint64_t v;
+float PseudoRandomSequenceAt(uint64_t* v, uint64_t seed, size_t index) {
   const double maxUInt64AsDouble = UINT64_MAX;
   if (index == 0) {
     // start of loop, reset to initial seed which was passed in and is based on
     // the domain key
-    v = seed;
+    *v = seed;
   }
   // get next value in PRNG sequence
-  v = lfsr_next(v);
+  *v = lfsr_next(*v);
   // return pseudo-random float between 0 and 0.1
-  return (v / maxUInt64AsDouble) / 10;
+  return (*v / maxUInt64AsDouble) / 10;
+}
+
+float PseudoRandomSequence(uint64_t seed,
+                           uint64_t* state,
+                           float value,
+                           size_t index) {
+  return PseudoRandomSequenceAt(state, seed, index);
 }
 
 }  // namespace
@@ -148,30 +154,68 @@ BraveSessionCache& BraveSessionCache::From(ExecutionContext& context) {
   return *cache;
 }
 
+BraveFarblingLevel BraveSessionCache::GetAudioFarblingLevel(
+    blink::WebContentSettingsClient* settings) {
+  if (!farbling_enabled_ || !settings)
+    return BraveFarblingLevel::OFF;
+  return settings->GetBraveFarblingLevel();
+}
+
+double BraveSessionCache::GetAudioFudgeFactor() {
+  const uint64_t* fudge = reinterpret_cast<const uint64_t*>(domain_key_);
+  const double maxUInt64AsDouble = UINT64_MAX;
+  return 0.99 + ((*fudge / maxUInt64AsDouble) / 100);
+}
+
 AudioFarblingCallback BraveSessionCache::GetAudioFarblingCallback(
     blink::WebContentSettingsClient* settings) {
-  if (farbling_enabled_ && settings) {
-    switch (settings->GetBraveFarblingLevel()) {
-      case BraveFarblingLevel::OFF: {
-        break;
-      }
-      case BraveFarblingLevel::BALANCED: {
-        const uint64_t* fudge = reinterpret_cast<const uint64_t*>(domain_key_);
-        const double maxUInt64AsDouble = UINT64_MAX;
-        double fudge_factor = 0.99 + ((*fudge / maxUInt64AsDouble) / 100);
-        VLOG(1) << "audio fudge factor (based on session token) = "
-                << fudge_factor;
-        return base::BindRepeating(&ConstantMultiplier, fudge_factor);
-      }
-      case BraveFarblingLevel::MAXIMUM: {
-        uint64_t seed = *reinterpret_cast<uint64_t*>(domain_key_);
-        return base::BindRepeating(&PseudoRandomSequence, seed);
-      }
+  switch (GetAudioFarblingLevel(settings)) {
+    case BraveFarblingLevel::OFF: {
+      break;
+    }
+    case BraveFarblingLevel::BALANCED: {
+      double fudge_factor = GetAudioFudgeFactor();
+      VLOG(1) << "audio fudge factor (based on session token) = "
+              << fudge_factor;
+      return base::BindRepeating(&ConstantMultiplier, fudge_factor);
+    }
+    case BraveFarblingLevel::MAXIMUM: {
+      uint64_t seed = *reinterpret_cast<uint64_t*>(domain_key_);
+      // Each callback owns its position in the sequence, so callbacks used on
+      // different threads don't interfere with each other.
+      return base::BindRepeating(&PseudoRandomSequence, seed,
+                                 base::Owned(new uint64_t(seed)));
     }
   }
   return base::BindRepeating(&Identity);
 }
 
+void BraveSessionCache::FarbleAudioChannel(
+    blink::WebContentSettingsClient* settings,
+    float* dst,
+    size_t count) {
+  switch (GetAudioFarblingLevel(settings)) {
+    case BraveFarblingLevel::OFF: {
+      break;
+    }
+    case BraveFarblingLevel::BALANCED: {
+      // Same arithmetic as ConstantMultiplier, but without a callback per
+      // sample this loop can be vectorized by the compiler.
+      const double fudge_factor = GetAudioFudgeFactor();
+      for (size_t i = 0; i < count; ++i)
+        dst[i] = dst[i] * fudge_factor;
+      break;
+    }
+    case BraveFarblingLevel::MAXIMUM: {
+      const uint64_t seed = *reinterpret_cast<uint64_t*>(domain_key_);
+      uint64_t v = seed;
+      for (size_t i = 0; i < count; ++i)
+        dst[i] = PseudoRandomSequenceAt(&v, seed, i);
+      break;
+    }
+  }
+}
+
 void BraveSessionCache::PerturbPixels(blink::WebContentSettingsClient* settings,
                                       const unsigned char* data,
                                       size_t size) {
@@ -46,6 +46,11 @@ class CORE_EXPORT BraveSessionCache final
 
   AudioFarblingCallback GetAudioFarblingCallback(
       blink::WebContentSettingsClient* settings);
+  // Farbles |count| samples of |dst| in place. Equivalent to running the
+  // callback above over the whole buffer, starting from index 0.
+  void FarbleAudioChannel(blink::WebContentSettingsClient* settings,
+                          float* dst,
+                          size_t count);
   void PerturbPixels(blink::WebContentSettingsClient* settings,
                      const unsigned char* data,
                      size_t size);
@@ -58,6 +63,9 @@ class CORE_EXPORT BraveSessionCache final
   uint64_t session_key_;
   uint8_t domain_key_[32];
 
+  BraveFarblingLevel GetAudioFarblingLevel(
+      blink::WebContentSettingsClient* settings);
+  double GetAudioFudgeFactor();
   void PerturbPixelsInternal(const unsigned char* data, size_t size);
 };
 }  // namespace brave
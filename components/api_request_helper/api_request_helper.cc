@@ -7,6 +7,7 @@
 
 #include <utility>
 
+#include "base/bind.h"
 #include "net/base/load_flags.h"
 #include "services/network/public/cpp/resource_request.h"
 #include "services/network/public/cpp/shared_url_loader_factory.h"
@@ -34,6 +35,27 @@ void APIRequestHelper::Request(
     ResultCallback callback,
     const base::flat_map<std::string, std::string>& headers /* ={} */,
     size_t max_body_size /* =-1 */) {
+  Request(method, url, payload, payload_content_type,
+          auto_retry_on_network_change,
+          base::BindOnce(
+              [](ResultCallback callback, const int response_code,
+                 std::string response_body,
+                 const base::flat_map<std::string, std::string>& headers) {
+                std::move(callback).Run(response_code, response_body, headers);
+              },
+              std::move(callback)),
+          headers, max_body_size);
+}
+
+void APIRequestHelper::Request(
+    const std::string& method,
+    const GURL& url,
+    const std::string& payload,
+    const std::string& payload_content_type,
+    bool auto_retry_on_network_change,
+    OwnedBodyResultCallback callback,
+    const base::flat_map<std::string, std::string>& headers /* ={} */,
+    size_t max_body_size /* =-1 */) {
   auto request = std::make_unique<network::ResourceRequest>();
   request->url = url;
   request->load_flags = net::LOAD_BYPASS_CACHE | net::LOAD_DISABLE_CACHE |
@@ -74,8 +96,8 @@ void APIRequestHelper::Request(
 
 void APIRequestHelper::OnResponse(
     SimpleURLLoaderList::iterator iter,
-    ResultCallback callback,
-    const std::unique_ptr<std::string> response_body) {
+    OwnedBodyResultCallback callback,
+    std::unique_ptr<std::string> response_body) {
   auto* loader = iter->get();
   auto response_code = -1;
   base::flat_map<std::string, std::string> headers;
@@ -93,7 +115,8 @@ void APIRequestHelper::OnResponse(
     }
   }
   url_loaders_.erase(iter);
-  std::move(callback).Run(response_code, response_body ? *response_body : "",
+  std::move(callback).Run(response_code,
+                          response_body ? std::move(*response_body) : "",
                           headers);
 }
 
@@ -43,14 +43,29 @@ class APIRequestHelper {
                const base::flat_map<std::string, std::string>& headers = {},
                size_t max_body_size = -1u);
 
+  // Same as above, but hands the response body over to |callback| so that a
+  // large body can be moved elsewhere without a copy.
+  using OwnedBodyResultCallback =
+      base::OnceCallback<void(const int,
+                              std::string,
+                              const base::flat_map<std::string, std::string>&)>;
+  void Request(const std::string& method,
+               const GURL& url,
+               const std::string& payload,
+               const std::string& payload_content_type,
+               bool auto_retry_on_network_change,
+               OwnedBodyResultCallback callback,
+               const base::flat_map<std::string, std::string>& headers = {},
+               size_t max_body_size = -1u);
+
  private:
   APIRequestHelper(const APIRequestHelper&) = delete;
   APIRequestHelper& operator=(const APIRequestHelper&) = delete;
   using SimpleURLLoaderList =
       std::list<std::unique_ptr<network::SimpleURLLoader>>;
   void OnResponse(SimpleURLLoaderList::iterator iter,
-                  ResultCallback callback,
-                  const std::unique_ptr<std::string> response_body);
+                  OwnedBodyResultCallback callback,
+                  std::unique_ptr<std::string> response_body);
 
   net::NetworkTrafficAnnotationTag annotation_tag_;
   SimpleURLLoaderList url_loaders_;
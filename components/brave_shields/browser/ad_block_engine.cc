@@ -6,6 +6,7 @@
 #include "brave/components/brave_shields/browser/ad_block_engine.h"
 
 #include <algorithm>
+#include <atomic>
 #include <set>
 #include <string>
 #include <utility>
@@ -27,6 +28,8 @@ using namespace net::registry_controlled_domains;  // NOLINT
 
 namespace {
 
+std::atomic<uint64_t> g_generation{0};
+
 std::string ResourceTypeToString(blink::mojom::ResourceType resource_type) {
   std::string filter_option = "";
   switch (resource_type) {
@@ -104,18 +107,14 @@ AdBlockEngine::~AdBlockEngine() {}
 void AdBlockEngine::ShouldStartRequest(const GURL& url,
                                        blink::mojom::ResourceType resource_type,
                                        const std::string& tab_host,
+                                       bool is_third_party,
                                        bool aggressive_blocking,
                                        bool* did_match_rule,
                                        bool* did_match_exception,
                                        bool* did_match_important,
                                        std::string* mock_data_url) {
-  // Determine third-party here so the library doesn't need to figure it out.
-  // CreateFromNormalizedTuple is needed because SameDomainOrHost needs
-  // a URL or origin and not a string to a host name.
-  bool is_third_party = !SameDomainOrHost(
-      url,
-      url::Origin::CreateFromNormalizedTuple("https", tab_host.c_str(), 80),
-      INCLUDE_PRIVATE_REGISTRIES);
+  // Third-party is determined once by the caller for all engines so the
+  // library doesn't need to figure it out.
   ad_block_client_->matches(url.spec(), url.host(), tab_host, is_third_party,
                             ResourceTypeToString(resource_type), did_match_rule,
                             did_match_exception, did_match_important,
@@ -150,6 +149,7 @@ absl::optional<std::string> AdBlockEngine::GetCspDirectives(
 }
 
 void AdBlockEngine::EnableTag(const std::string& tag, bool enabled) {
+  IncrementGeneration();
   if (enabled) {
     if (tags_.find(tag) == tags_.end()) {
       ad_block_client_->addTag(tag);
@@ -166,9 +166,20 @@ void AdBlockEngine::EnableTag(const std::string& tag, bool enabled) {
 }
 
 void AdBlockEngine::AddResources(const std::string& resources) {
+  IncrementGeneration();
   ad_block_client_->addResources(resources);
 }
 
+// static
+uint64_t AdBlockEngine::GetGeneration() {
+  return g_generation.load(std::memory_order_acquire);
+}
+
+// static
+void AdBlockEngine::IncrementGeneration() {
+  g_generation.fetch_add(1, std::memory_order_acq_rel);
+}
+
 bool AdBlockEngine::TagExists(const std::string& tag) {
   return std::find(tags_.begin(), tags_.end(), tag) != tags_.end();
 }
@@ -206,6 +217,7 @@ void AdBlockEngine::UpdateAdBlockClient(
     std::unique_ptr<adblock::Engine> ad_block_client,
     const std::string& resources_json) {
   ad_block_client_ = std::move(ad_block_client);
+  IncrementGeneration();
   AddResources(resources_json);
   AddKnownTagsToAdBlockInstance();
   if (test_observer_) {
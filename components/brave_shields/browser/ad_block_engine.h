@@ -47,6 +47,7 @@ class AdBlockEngine : public base::SupportsWeakPtr<AdBlockEngine> {
   void ShouldStartRequest(const GURL& url,
                           blink::mojom::ResourceType resource_type,
                           const std::string& tab_host,
+                          bool is_third_party,
                           bool aggressive_blocking,
                           bool* did_match_rule,
                           bool* did_match_exception,
@@ -75,6 +76,12 @@ class AdBlockEngine : public base::SupportsWeakPtr<AdBlockEngine> {
     virtual void OnEngineUpdated() = 0;
   };
 
+  // Returns a counter which is incremented whenever the rules, tags or
+  // resources of any engine change, or engines are added or removed, so that
+  // cached matching results can be invalidated.
+  static uint64_t GetGeneration();
+  static void IncrementGeneration();
+
   void AddObserverForTest(TestObserver* observer);
   void RemoveObserverForTest();
 
@@ -160,6 +160,7 @@ void AdBlockRegionalServiceManager::ShouldStartRequest(
     const GURL& url,
     blink::mojom::ResourceType resource_type,
     const std::string& tab_host,
+    bool is_third_party,
     bool aggressive_blocking,
     bool* did_match_rule,
     bool* did_match_exception,
@@ -169,8 +170,9 @@ void AdBlockRegionalServiceManager::ShouldStartRequest(
 
   for (const auto& regional_service : regional_services_) {
     regional_service.second->ShouldStartRequest(
-        url, resource_type, tab_host, aggressive_blocking, did_match_rule,
-        did_match_exception, did_match_important, mock_data_url);
+        url, resource_type, tab_host, is_third_party, aggressive_blocking,
+        did_match_rule, did_match_exception, did_match_important,
+        mock_data_url);
     if (did_match_important && *did_match_important) {
       return;
     }
@@ -239,6 +241,7 @@ void AdBlockRegionalServiceManager::EnableFilterList(const std::string& uuid,
 
     DCHECK(it != regional_services_.end());
     regional_services_.erase(it);
+    AdBlockEngine::IncrementGeneration();
 
     auto it2 = regional_filters_providers_.find(uuid);
     DCHECK(it2 != regional_filters_providers_.end());
@@ -62,6 +62,7 @@ class AdBlockRegionalServiceManager
   void ShouldStartRequest(const GURL& url,
                           blink::mojom::ResourceType resource_type,
                           const std::string& tab_host,
+                          bool is_third_party,
                           bool aggressive_blocking,
                           bool* did_match_rule,
                           bool* did_match_exception,
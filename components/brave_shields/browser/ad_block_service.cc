@@ -14,6 +14,7 @@
 #include "base/files/file_path.h"
 #include "base/logging.h"
 #include "base/memory/ptr_util.h"
+#include "base/metrics/histogram_macros.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/utf_string_conversions.h"
 #include "base/threading/thread_restrictions.h"
@@ -114,37 +115,98 @@ void AdBlockService::ShouldStartRequest(
     bool* did_match_important,
     std::string* mock_data_url) {
   DCHECK(GetTaskRunner()->RunsTasksInCurrentSequence());
+  // Only requests without a previous result are cached, i.e. not CNAME
+  // uncloaked requests which are matched on top of an earlier result.
+  const bool is_cacheable = did_match_rule && !*did_match_rule &&
+                            did_match_exception && !*did_match_exception &&
+                            did_match_important && !*did_match_important &&
+                            mock_data_url && mock_data_url->empty();
+  if (!is_cacheable) {
+    ShouldStartRequestForEngines(url, resource_type, tab_host,
+                                 aggressive_blocking, did_match_rule,
+                                 did_match_exception, did_match_important,
+                                 mock_data_url);
+    return;
+  }
+
+  const uint64_t generation = AdBlockEngine::GetGeneration();
+  if (generation != request_cache_generation_) {
+    request_cache_.Clear();
+    request_cache_generation_ = generation;
+  }
+
+  RequestCacheKey key(url.spec(), tab_host, resource_type, aggressive_blocking);
+  auto it = request_cache_.Get(key);
+  UMA_HISTOGRAM_BOOLEAN("Brave.Adblock.ShouldStartRequestCacheHit",
+                        it != request_cache_.end());
+  if (it != request_cache_.end()) {
+    *did_match_rule = it->second.did_match_rule;
+    *did_match_exception = it->second.did_match_exception;
+    *did_match_important = it->second.did_match_important;
+    *mock_data_url = it->second.mock_data_url;
+    return;
+  }
+
+  ShouldStartRequestForEngines(url, resource_type, tab_host,
+                               aggressive_blocking, did_match_rule,
+                               did_match_exception, did_match_important,
+                               mock_data_url);
+
+  CachedRequestResult result;
+  result.did_match_rule = *did_match_rule;
+  result.did_match_exception = *did_match_exception;
+  result.did_match_important = *did_match_important;
+  result.mock_data_url = *mock_data_url;
+  request_cache_.Put(std::move(key), std::move(result));
+}
+
+void AdBlockService::ShouldStartRequestForEngines(
+    const GURL& url,
+    blink::mojom::ResourceType resource_type,
+    const std::string& tab_host,
+    bool aggressive_blocking,
+    bool* did_match_rule,
+    bool* did_match_exception,
+    bool* did_match_important,
+    std::string* mock_data_url) {
+  DCHECK(GetTaskRunner()->RunsTasksInCurrentSequence());
+  // Determine third-party once for every engine, as it requires a registry
+  // lookup. CreateFromNormalizedTuple is needed because SameDomainOrHost needs
+  // a URL or origin and not a string to a host name.
+  const bool is_third_party = !SameDomainOrHost(
+      url, url::Origin::CreateFromNormalizedTuple("https", tab_host, 80),
+      net::registry_controlled_domains::INCLUDE_PRIVATE_REGISTRIES);
+
   if (aggressive_blocking ||
       base::FeatureList::IsEnabled(
           brave_shields::features::kBraveAdblockDefault1pBlocking) ||
-      !SameDomainOrHost(
-          url, url::Origin::CreateFromNormalizedTuple("https", tab_host, 80),
-          net::registry_controlled_domains::INCLUDE_PRIVATE_REGISTRIES)) {
+      is_third_party) {
     default_service()->ShouldStartRequest(
-        url, resource_type, tab_host, aggressive_blocking, did_match_rule,
-        did_match_exception, did_match_important, mock_data_url);
+        url, resource_type, tab_host, is_third_party, aggressive_blocking,
+        did_match_rule, did_match_exception, did_match_important,
+        mock_data_url);
     if (did_match_important && *did_match_important) {
       return;
     }
   }
 
   regional_service_manager()->ShouldStartRequest(
-      url, resource_type, tab_host, aggressive_blocking, did_match_rule,
-      did_match_exception, did_match_important, mock_data_url);
+      url, resource_type, tab_host, is_third_party, aggressive_blocking,
+      did_match_rule, did_match_exception, did_match_important, mock_data_url);
   if (did_match_important && *did_match_important) {
     return;
   }
 
   subscription_service_manager()->ShouldStartRequest(
-      url, resource_type, tab_host, aggressive_blocking, did_match_rule,
-      did_match_exception, did_match_important, mock_data_url);
+      url, resource_type, tab_host, is_third_party, aggressive_blocking,
+      did_match_rule, did_match_exception, did_match_important, mock_data_url);
   if (did_match_important && *did_match_important) {
     return;
   }
 
   custom_filters_service()->ShouldStartRequest(
-      url, resource_type, tab_host, aggressive_blocking, did_match_rule,
-      did_match_exception, did_match_important, mock_data_url);
+      url, resource_type, tab_host, is_third_party, aggressive_blocking,
+      did_match_rule, did_match_exception, did_match_important, mock_data_url);
 }
 
 absl::optional<std::string> AdBlockService::GetCspDirectives(
@@ -314,7 +376,8 @@ AdBlockService::AdBlockService(
       task_runner_(task_runner),
       custom_filters_service_(nullptr, base::OnTaskRunnerDeleter(task_runner_)),
       default_service_(nullptr, base::OnTaskRunnerDeleter(task_runner_)),
-      subscription_service_manager_(std::move(subscription_service_manager)) {
+      subscription_service_manager_(std::move(subscription_service_manager)),
+      request_cache_(kMaxRequestCacheSize) {
   // Initializes adblock-rust's domain resolution implementation
   adblock::SetDomainResolver(AdBlockServiceDomainResolver);
 
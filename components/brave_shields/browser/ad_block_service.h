@@ -10,8 +10,10 @@
 
 #include <memory>
 #include <string>
+#include <tuple>
 #include <vector>
 
+#include "base/containers/lru_cache.h"
 #include "base/memory/raw_ptr.h"
 #include "base/memory/weak_ptr.h"
 #include "base/sequence_checker.h"
@@ -130,6 +132,28 @@ class AdBlockService {
 
   static std::string g_ad_block_dat_file_version_;
 
+  static constexpr size_t kMaxRequestCacheSize = 1000;
+
+  struct CachedRequestResult {
+    bool did_match_rule = false;
+    bool did_match_exception = false;
+    bool did_match_important = false;
+    std::string mock_data_url;
+  };
+
+  // <url, tab_host, resource_type, aggressive_blocking>
+  using RequestCacheKey = std::
+      tuple<std::string, std::string, blink::mojom::ResourceType, bool>;
+
+  void ShouldStartRequestForEngines(const GURL& url,
+                                    blink::mojom::ResourceType resource_type,
+                                    const std::string& tab_host,
+                                    bool aggressive_blocking,
+                                    bool* did_match_rule,
+                                    bool* did_match_exception,
+                                    bool* did_match_important,
+                                    std::string* mock_data_url);
+
   AdBlockResourceProvider* resource_provider();
 
   void UseSourceProvidersForTest(AdBlockFiltersProvider* source_provider,
@@ -163,6 +187,11 @@ class AdBlockService {
   std::unique_ptr<SourceProviderObserver> default_service_observer_;
   std::unique_ptr<SourceProviderObserver> custom_filters_service_observer_;
 
+  // Results of |ShouldStartRequest| for recently matched requests, accessed
+  // on |task_runner_| only. Cleared whenever the engine generation changes.
+  base::LRUCache<RequestCacheKey, CachedRequestResult> request_cache_;
+  uint64_t request_cache_generation_ = 0;
+
   SEQUENCE_CHECKER(sequence_checker_);
 
   base::WeakPtrFactory<AdBlockService> weak_factory_{this};
@@ -274,6 +274,7 @@ void AdBlockSubscriptionServiceManager::DeleteSubscription(
     auto it = subscription_services_.find(sub_url);
     DCHECK(it != subscription_services_.end());
     subscription_services_.erase(it);
+    AdBlockEngine::IncrementGeneration();
     auto it2 = subscription_filters_providers_.find(sub_url);
     DCHECK(it2 != subscription_filters_providers_.end());
     subscription_filters_providers_.erase(it2);
@@ -341,6 +342,17 @@ absl::optional<SubscriptionInfo> AdBlockSubscriptionServiceManager::GetInfo(
       BuildInfoFromDict(sub_url, list_subscription_dict));
 }
 
+bool AdBlockSubscriptionServiceManager::IsEnabled(const GURL& sub_url) {
+  // Only the enabled flag is needed on the per-request path, so avoid building
+  // a whole SubscriptionInfo.
+  const auto* list_subscription_dict =
+      subscriptions_->FindDictKey(sub_url.spec());
+  if (!list_subscription_dict)
+    return false;
+
+  return list_subscription_dict->FindBoolKey("enabled").value_or(false);
+}
+
 void AdBlockSubscriptionServiceManager::LoadSubscriptionServices() {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
@@ -408,6 +420,8 @@ void AdBlockSubscriptionServiceManager::UpdateSubscriptionPrefs(
   base::AutoLock lock(subscription_services_lock_);
   subscriptions_ = base::DictionaryValue::From(
       base::Value::ToUniquePtrValue(subscriptions_dict->Clone()));
+  // The enabled state of subscriptions may have changed.
+  AdBlockEngine::IncrementGeneration();
 }
 
 // Updates preferences to remove all state for the specified filter list
@@ -426,6 +440,8 @@ void AdBlockSubscriptionServiceManager::ClearSubscriptionPrefs(
   base::AutoLock lock(subscription_services_lock_);
   subscriptions_ = base::DictionaryValue::From(
       base::Value::ToUniquePtrValue(subscriptions_dict->Clone()));
+  // The enabled state of subscriptions may have changed.
+  AdBlockEngine::IncrementGeneration();
 }
 
 bool AdBlockSubscriptionServiceManager::Start() {
@@ -436,6 +452,7 @@ void AdBlockSubscriptionServiceManager::ShouldStartRequest(
     const GURL& url,
     blink::mojom::ResourceType resource_type,
     const std::string& tab_host,
+    bool is_third_party,
     bool aggressive_blocking,
     bool* did_match_rule,
     bool* did_match_exception,
@@ -443,11 +460,11 @@ void AdBlockSubscriptionServiceManager::ShouldStartRequest(
     std::string* mock_data_url) {
   base::AutoLock lock(subscription_services_lock_);
   for (const auto& subscription_service : subscription_services_) {
-    auto info = GetInfo(subscription_service.first);
-    if (info && info->enabled) {
+    if (IsEnabled(subscription_service.first)) {
       subscription_service.second->ShouldStartRequest(
-          url, resource_type, tab_host, aggressive_blocking, did_match_rule,
-          did_match_exception, did_match_important, mock_data_url);
+          url, resource_type, tab_host, is_third_party, aggressive_blocking,
+          did_match_rule, did_match_exception, did_match_important,
+          mock_data_url);
       if (did_match_important && *did_match_important) {
         return;
       }
@@ -92,6 +92,7 @@ class AdBlockSubscriptionServiceManager {
   void ShouldStartRequest(const GURL& url,
                           blink::mojom::ResourceType resource_type,
                           const std::string& tab_host,
+                          bool is_third_party,
                           bool aggressive_blocking,
                           bool* did_match_rule,
                           bool* did_match_exception,
@@ -139,6 +140,7 @@ class AdBlockSubscriptionServiceManager {
       AdBlockSubscriptionDownloadManager* download_manager);
 
   absl::optional<SubscriptionInfo> GetInfo(const GURL& sub_url);
+  bool IsEnabled(const GURL& sub_url);
   void NotifyObserversOfServiceEvent();
 
   void SetUpdateIntervalsForTesting(base::TimeDelta* initial_delay,
@@ -8,38 +8,23 @@
 
 #include <string>
 
-#include "base/containers/lru_cache.h"
-#include "base/synchronization/lock.h"
+#include "brave/components/brave_shields/browser/sharded_clock_cache.h"
 
+// Caches the result of recent HTTPSE lookups. This is queried for every
+// request, so it is backed by a sharded cache whose hits don't serialize
+// all callers behind one lock.
 template <class T> class HTTPSERecentlyUsedCache {
  public:
   explicit HTTPSERecentlyUsedCache(size_t size = 100) : data_(size) {}
 
-  void add(const std::string& key, const T& value) {
-    base::AutoLock create(lock_);
-    data_.Put(key, value);
-  }
-
-  bool get(const std::string& key, T* value) {
-    base::AutoLock create(lock_);
-    auto it = data_.Get(key);
-    if (it != data_.end()) {
-      *value = it->second;
-      return true;
-    }
-    return false;
-  }
-
-  void remove(const std::string& key) {
-    base::AutoLock lock(lock_);
-    auto it = data_.Peek(key);
-    if (it != data_.end())
-      data_.Erase(it);
-  }
+  void add(const std::string& key, const T& value) { data_.Put(key, value); }
+
+  bool get(const std::string& key, T* value) { return data_.Get(key, value); }
+
+  void remove(const std::string& key) { data_.Erase(key); }
 
  private:
-  base::LRUCache<std::string, T> data_;
-  base::Lock lock_;
+  brave_shields::ShardedClockCache<std::string, T> data_;
 };
 
 #endif  // BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_HTTPS_EVERYWHERE_RECENTLY_USED_CACHE_H_
@@ -6,6 +6,7 @@
 #include "brave/components/brave_shields/browser/https_everywhere_service.h"
 
 #include <algorithm>
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -30,6 +31,8 @@
 
 namespace {
 
+constexpr size_t kMaxRuleSetsCacheSize = 1000;
+
 std::vector<std::string> Split(const std::string& s, char delim) {
   std::stringstream ss(s);
   std::string item;
@@ -65,22 +68,37 @@ std::vector<std::string> ExpandDomainForLookup(const std::string& domain) {
   }
   return resultDomains;
 }
-std::string leveldbGet(leveldb::DB* db, const std::string &key) {
+leveldb::Status leveldbGet(leveldb::DB* db,
+                           const std::string& key,
+                           std::string* value) {
+  DCHECK(value);
   if (!db) {
-    return "";
+    return leveldb::Status::IOError("Database is not open");
   }
 
-  std::string value;
-  leveldb::Status s = db->Get(leveldb::ReadOptions(), key, &value);
-  return s.ok() ? value : "";
+  return db->Get(leveldb::ReadOptions(), key, value);
 }
 
 }  // namespace
 
 namespace brave_shields {
 
+HTTPSEverywhereService::Engine::Rule::Rule() = default;
+HTTPSEverywhereService::Engine::Rule::Rule(Rule&&) = default;
+HTTPSEverywhereService::Engine::Rule&
+HTTPSEverywhereService::Engine::Rule::operator=(Rule&&) = default;
+HTTPSEverywhereService::Engine::Rule::~Rule() = default;
+
+HTTPSEverywhereService::Engine::RuleSet::RuleSet() = default;
+HTTPSEverywhereService::Engine::RuleSet::RuleSet(RuleSet&&) = default;
+HTTPSEverywhereService::Engine::RuleSet&
+HTTPSEverywhereService::Engine::RuleSet::operator=(RuleSet&&) = default;
+HTTPSEverywhereService::Engine::RuleSet::~RuleSet() = default;
+
 HTTPSEverywhereService::Engine::Engine(HTTPSEverywhereService* service)
-    : level_db_(nullptr), service_(service) {
+    : rule_sets_cache_(kMaxRuleSetsCacheSize),
+      level_db_(nullptr),
+      service_(service) {
   DETACH_FROM_SEQUENCE(sequence_checker_);
 }
 
@@ -144,10 +162,10 @@ bool HTTPSEverywhereService::Engine::GetHTTPSURL(
   SCOPED_UMA_HISTOGRAM_TIMER("Brave.HTTPSE.GetHTTPSURL");
   const std::vector<std::string> domains =
       ExpandDomainForLookup(candidate_url.host());
-  for (auto domain : domains) {
-    std::string value = leveldbGet(level_db_, domain);
-    if (!value.empty()) {
-      *new_url = ApplyHTTPSRule(candidate_url.spec(), value);
+  for (const auto& domain : domains) {
+    const std::vector<RuleSet>* rule_sets = GetRuleSets(domain);
+    if (rule_sets && !rule_sets->empty()) {
+      *new_url = ApplyRuleSets(candidate_url.spec(), *rule_sets);
       if (0 != new_url->length()) {
         service_->recently_used_cache().add(candidate_url.spec(), *new_url);
         service_->AddHTTPSEUrlToRedirectList(request_identifier);
@@ -159,100 +177,115 @@ bool HTTPSEverywhereService::Engine::GetHTTPSURL(
   return false;
 }
 
-std::string HTTPSEverywhereService::Engine::ApplyHTTPSRule(
-    const std::string& originalUrl,
-    const std::string& rule) {
+const std::vector<HTTPSEverywhereService::Engine::RuleSet>*
+HTTPSEverywhereService::Engine::GetRuleSets(const std::string& domain) {
+  auto it = rule_sets_cache_.Get(domain);
+  if (it != rule_sets_cache_.end())
+    return &it->second;
+
+  std::string value;
+  const leveldb::Status status = leveldbGet(level_db_, domain, &value);
+  if (!status.ok() && !status.IsNotFound()) {
+    // Only a missing key means the domain has no rules, so do not cache
+    // read errors.
+    return nullptr;
+  }
+
+  return &rule_sets_cache_.Put(domain, ParseRuleSets(value))->second;
+}
+
+std::vector<HTTPSEverywhereService::Engine::RuleSet>
+HTTPSEverywhereService::Engine::ParseRuleSets(const std::string& rule) {
+  std::vector<RuleSet> rule_sets;
+  if (rule.empty())
+    return rule_sets;
+
   absl::optional<base::Value> json_object = base::JSONReader::Read(rule);
   if (absl::nullopt == json_object || !json_object->is_list()) {
-    return "";
+    return rule_sets;
   }
 
-  base::Value::ConstListView topValues = json_object->GetList();
-  for (auto it = topValues.cbegin(); it != topValues.cend(); ++it) {
-    if (!it->is_dict()) {
-      continue;
-    }
-    const base::DictionaryValue* childTopDictionary = nullptr;
-    it->GetAsDictionary(&childTopDictionary);
-    if (nullptr == childTopDictionary) {
+  for (const auto& top_value : json_object->GetList()) {
+    if (!top_value.is_dict()) {
       continue;
     }
 
-    const base::Value* exclusion = nullptr;
-    if (childTopDictionary->Get("e", &exclusion)) {
-      const base::ListValue* eValues = nullptr;
-      exclusion->GetAsList(&eValues);
-      if (nullptr != eValues) {
-        for (size_t j = 0; j < eValues->GetList().size(); ++j) {
-          const base::Value* pValue = nullptr;
-          if (!eValues->Get(j, &pValue)) {
-            continue;
-          }
-          const base::DictionaryValue* pDictionary = nullptr;
-          pValue->GetAsDictionary(&pDictionary);
-          if (nullptr == pDictionary) {
-            continue;
-          }
-          const base::Value* patternValue = nullptr;
-          if (!pDictionary->Get("p", &patternValue)) {
-            continue;
-          }
-          std::string pattern;
-          if (!patternValue->GetAsString(&pattern)) {
-            continue;
-          }
-          pattern = CorrecttoRuleToRE2Engine(pattern);
-          if (RE2::FullMatch(originalUrl, pattern)) {
-            return "";
-          }
+    RuleSet rule_set;
+    const base::Value* exclusions = top_value.FindListKey("e");
+    if (exclusions) {
+      for (const auto& exclusion : exclusions->GetList()) {
+        if (!exclusion.is_dict()) {
+          continue;
+        }
+        const std::string* pattern = exclusion.FindStringKey("p");
+        if (!pattern) {
+          continue;
         }
+        rule_set.exclusions.push_back(
+            std::make_unique<RE2>(CorrecttoRuleToRE2Engine(*pattern)));
       }
     }
 
-    const base::Value* rules = nullptr;
-    if (!childTopDictionary->Get("r", &rules)) {
-      return "";
-    }
-    const base::ListValue* rValues = nullptr;
-    rules->GetAsList(&rValues);
-    if (nullptr == rValues) {
-      return "";
+    const base::Value* rules = top_value.FindListKey("r");
+    if (!rules) {
+      // Evaluation stops at a ruleset without rules, so later rulesets are
+      // never used.
+      rule_sets.push_back(std::move(rule_set));
+      return rule_sets;
     }
+    rule_set.has_rules = true;
 
-    for (size_t j = 0; j < rValues->GetList().size(); ++j) {
-      const base::Value* pValue = nullptr;
-      if (!rValues->Get(j, &pValue)) {
-        continue;
-      }
-      const base::DictionaryValue* pDictionary = nullptr;
-      pValue->GetAsDictionary(&pDictionary);
-      if (nullptr == pDictionary) {
+    for (const auto& rule_value : rules->GetList()) {
+      if (!rule_value.is_dict()) {
         continue;
       }
-      const base::Value* patternValue = nullptr;
-      if (pDictionary->Get("d", &patternValue)) {
-        std::string newUrl(originalUrl);
-        return newUrl.insert(4, "s");
+      Rule parsed_rule;
+      if (rule_value.FindKey("d")) {
+        parsed_rule.is_default = true;
+        rule_set.rules.push_back(std::move(parsed_rule));
+        // Evaluation stops at a default rule.
+        break;
       }
 
-      const base::Value* from_value = nullptr;
-      const base::Value* to_value = nullptr;
-      if (!pDictionary->Get("f", &from_value) ||
-          !pDictionary->Get("t", &to_value)) {
+      const std::string* from = rule_value.FindStringKey("f");
+      const std::string* to = rule_value.FindStringKey("t");
+      if (!from || !to) {
         continue;
       }
-      std::string from, to;
-      if (!from_value->GetAsString(&from) ||
-          !to_value->GetAsString(&to)) {
-        continue;
+      parsed_rule.from = std::make_unique<RE2>(*from);
+      parsed_rule.to = CorrecttoRuleToRE2Engine(*to);
+      rule_set.rules.push_back(std::move(parsed_rule));
+    }
+
+    rule_sets.push_back(std::move(rule_set));
+  }
+
+  return rule_sets;
+}
+
+std::string HTTPSEverywhereService::Engine::ApplyRuleSets(
+    const std::string& original_url,
+    const std::vector<RuleSet>& rule_sets) {
+  for (const auto& rule_set : rule_sets) {
+    for (const auto& exclusion : rule_set.exclusions) {
+      if (RE2::FullMatch(original_url, *exclusion)) {
+        return "";
       }
+    }
 
-      to = CorrecttoRuleToRE2Engine(to);
-      std::string newUrl(originalUrl);
-      RE2 regExp(from);
+    if (!rule_set.has_rules) {
+      return "";
+    }
+
+    for (const auto& rule : rule_set.rules) {
+      std::string new_url(original_url);
+      if (rule.is_default) {
+        return new_url.insert(4, "s");
+      }
 
-      if (RE2::Replace(&newUrl, regExp, to) && newUrl != originalUrl) {
-        return newUrl;
+      if (RE2::Replace(&new_url, *rule.from, rule.to) &&
+          new_url != original_url) {
+        return new_url;
       }
     }
   }
@@ -273,6 +306,7 @@ std::string HTTPSEverywhereService::Engine::CorrecttoRuleToRE2Engine(
 
 void HTTPSEverywhereService::Engine::CloseDatabase() {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  rule_sets_cache_.Clear();
   if (level_db_) {
     delete level_db_;
     level_db_ = nullptr;
@@ -10,6 +10,7 @@
 #include <string>
 #include <vector>
 
+#include "base/containers/lru_cache.h"
 #include "base/files/file_path.h"
 #include "base/memory/weak_ptr.h"
 #include "base/sequence_checker.h"
@@ -21,6 +22,11 @@ namespace leveldb {
 class DB;
 }
 
+namespace re2 {
+class RE2;
+}  // namespace re2
+
+class HTTPSEverywhereEngineTest;
 class HTTPSEverywhereServiceTest;
 
 using brave_component_updater::BraveComponent;
@@ -63,11 +69,46 @@ class HTTPSEverywhereService : public BaseBraveShieldsService {
                      std::string* new_url);
 
    private:
-    std::string ApplyHTTPSRule(const std::string& originalUrl,
-                               const std::string& rule);
-    std::string CorrecttoRuleToRE2Engine(const std::string& to);
+    // A rule of a ruleset, with its regular expression compiled once.
+    struct Rule {
+      Rule();
+      Rule(Rule&&);
+      Rule& operator=(Rule&&);
+      ~Rule();
+
+      // Rewrites the scheme to https without matching |from|.
+      bool is_default = false;
+      std::unique_ptr<re2::RE2> from;
+      std::string to;
+    };
+
+    // A ruleset parsed from the JSON stored in the database.
+    struct RuleSet {
+      RuleSet();
+      RuleSet(RuleSet&&);
+      RuleSet& operator=(RuleSet&&);
+      ~RuleSet();
+
+      std::vector<std::unique_ptr<re2::RE2>> exclusions;
+      // A ruleset without a valid list of rules stops rule evaluation.
+      bool has_rules = false;
+      std::vector<Rule> rules;
+    };
+
+    friend class ::HTTPSEverywhereEngineTest;
+
+    // Returns nullptr if the rulesets for |domain| could not be read.
+    const std::vector<RuleSet>* GetRuleSets(const std::string& domain);
+    static std::vector<RuleSet> ParseRuleSets(const std::string& rule);
+    static std::string ApplyRuleSets(const std::string& original_url,
+                                     const std::vector<RuleSet>& rule_sets);
+    static std::string CorrecttoRuleToRE2Engine(const std::string& to);
     void CloseDatabase();
 
+    // Parsed rulesets of recently looked up domains, including domains which
+    // have no rules, so that repeated lookups neither hit the database nor
+    // parse JSON and compile regular expressions again.
+    base::LRUCache<std::string, std::vector<RuleSet>> rule_sets_cache_;
     leveldb::DB* level_db_;
     HTTPSEverywhereService* service_;  // not owned
     SEQUENCE_CHECKER(sequence_checker_);
@@ -0,0 +1,103 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <string>
+
+#include "brave/components/brave_shields/browser/https_everywhere_service.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+using brave_shields::HTTPSEverywhereService;
+
+class HTTPSEverywhereEngineTest : public testing::Test {
+ protected:
+  static size_t CountRuleSets(const std::string& rule) {
+    return HTTPSEverywhereService::Engine::ParseRuleSets(rule).size();
+  }
+
+  static size_t CountRules(const std::string& rule, size_t index) {
+    const auto rule_sets = HTTPSEverywhereService::Engine::ParseRuleSets(rule);
+    return rule_sets.at(index).rules.size();
+  }
+
+  static std::string Apply(const std::string& url, const std::string& rule) {
+    return HTTPSEverywhereService::Engine::ApplyRuleSets(
+        url, HTTPSEverywhereService::Engine::ParseRuleSets(rule));
+  }
+};
+
+TEST_F(HTTPSEverywhereEngineTest, ParseInvalidRuleSets) {
+  EXPECT_EQ(0u, CountRuleSets(""));
+  EXPECT_EQ(0u, CountRuleSets("not json"));
+  EXPECT_EQ(0u, CountRuleSets(R"({"r": [{"d": 1}]})"));
+}
+
+TEST_F(HTTPSEverywhereEngineTest, ParseStopsAtRuleSetWithoutRules) {
+  const std::string rule = R"([
+    {"e": [{"p": "^http://example\\.com/private"}]},
+    {"r": [{"d": 1}]}
+  ])";
+
+  EXPECT_EQ(1u, CountRuleSets(rule));
+  EXPECT_EQ("", Apply("http://example.com/", rule));
+}
+
+TEST_F(HTTPSEverywhereEngineTest, ParseStopsAtDefaultRule) {
+  const std::string rule = R"([
+    {"r": [
+      {"d": 1},
+      {"f": "^http://example\\.com/", "t": "https://www.example.com/"}
+    ]}
+  ])";
+
+  EXPECT_EQ(1u, CountRules(rule, 0));
+  EXPECT_EQ("https://example.com/", Apply("http://example.com/", rule));
+}
+
+TEST_F(HTTPSEverywhereEngineTest, ApplyRuleBeforeDefaultRule) {
+  const std::string rule = R"([
+    {"r": [
+      {"f": "^http://example\\.com/", "t": "https://www.example.com/"},
+      {"d": 1}
+    ]}
+  ])";
+
+  EXPECT_EQ("https://www.example.com/", Apply("http://example.com/", rule));
+  EXPECT_EQ("https://other.example.com/",
+            Apply("http://other.example.com/", rule));
+}
+
+TEST_F(HTTPSEverywhereEngineTest, ApplyExclusionsBeforeRules) {
+  const std::string rule = R"([
+    {
+      "e": [{"p": "^http://example\\.com/private/.*"}],
+      "r": [{"d": 1}]
+    }
+  ])";
+
+  EXPECT_EQ("", Apply("http://example.com/private/page", rule));
+  EXPECT_EQ("https://example.com/public/page",
+            Apply("http://example.com/public/page", rule));
+}
+
+TEST_F(HTTPSEverywhereEngineTest, ApplyRuleWithCaptureGroup) {
+  const std::string rule = R"([
+    {"r": [
+      {"f": "^http://(www\\.)?example\\.com/", "t": "https://$1example.com/"}
+    ]}
+  ])";
+
+  EXPECT_EQ("https://www.example.com/page",
+            Apply("http://www.example.com/page", rule));
+  EXPECT_EQ("", Apply("http://example.org/page", rule));
+}
+
+TEST_F(HTTPSEverywhereEngineTest, ApplyNextRuleSetIfNoRuleMatches) {
+  const std::string rule = R"([
+    {"r": [{"f": "^http://example\\.org/", "t": "https://example.org/"}]},
+    {"r": [{"d": 1}]}
+  ])";
+
+  EXPECT_EQ("https://example.com/", Apply("http://example.com/", rule));
+}
@@ -0,0 +1,185 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_SHARDED_CLOCK_CACHE_H_
+#define BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_SHARDED_CLOCK_CACHE_H_
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "base/check_op.h"
+#include "base/synchronization/lock.h"
+#include "base/thread_annotations.h"
+
+namespace brave_shields {
+
+// A fixed capacity cache which can be used from multiple threads at once.
+//
+// Keys are spread over independently locked shards so that concurrent
+// lookups of different keys rarely contend. Within a shard entries are
+// evicted using the CLOCK (second chance) algorithm: a hit only marks the
+// entry as referenced instead of reordering a list, so each critical section
+// is a single hash lookup.
+template <class Key, class Value, class Hash = std::hash<Key>>
+class ShardedClockCache {
+ public:
+  // Shards smaller than this would evict too eagerly, so small caches use
+  // fewer shards.
+  static constexpr size_t kMinShardCapacity = 16;
+  static constexpr size_t kMaxShardCount = 16;
+
+  explicit ShardedClockCache(size_t capacity) {
+    DCHECK_GT(capacity, 0u);
+    const size_t shard_count = std::max<size_t>(
+        1, std::min(kMaxShardCount, capacity / kMinShardCapacity));
+    shards_.reserve(shard_count);
+    for (size_t i = 0; i < shard_count; ++i) {
+      // Distribute the remainder so the total capacity is exact.
+      const size_t shard_capacity =
+          capacity / shard_count + (i < capacity % shard_count ? 1 : 0);
+      shards_.push_back(std::make_unique<Shard>(shard_capacity));
+    }
+  }
+
+  ShardedClockCache(const ShardedClockCache&) = delete;
+  ShardedClockCache& operator=(const ShardedClockCache&) = delete;
+
+  // Inserts or replaces the value for |key|.
+  void Put(const Key& key, const Value& value) {
+    GetShard(key).Put(key, value);
+  }
+
+  // Copies the value for |key| into |value| and returns true if present.
+  bool Get(const Key& key, Value* value) {
+    DCHECK(value);
+    return GetShard(key).Get(key, value);
+  }
+
+  void Erase(const Key& key) { GetShard(key).Erase(key); }
+
+  void Clear() {
+    for (auto& shard : shards_)
+      shard->Clear();
+  }
+
+  size_t shard_count() const { return shards_.size(); }
+
+ private:
+  class Shard {
+   public:
+    explicit Shard(size_t capacity) : capacity_(capacity) {
+      slots_.reserve(capacity);
+    }
+
+    Shard(const Shard&) = delete;
+    Shard& operator=(const Shard&) = delete;
+
+    void Put(const Key& key, const Value& value) {
+      base::AutoLock lock(lock_);
+      auto it = index_.find(key);
+      if (it != index_.end()) {
+        Slot& slot = slots_[it->second];
+        slot.value = value;
+        slot.referenced = true;
+        return;
+      }
+
+      size_t slot_index;
+      if (!free_slots_.empty()) {
+        slot_index = free_slots_.back();
+        free_slots_.pop_back();
+      } else if (slots_.size() < capacity_) {
+        slot_index = slots_.size();
+        slots_.emplace_back();
+      } else {
+        slot_index = Evict();
+      }
+
+      Slot& slot = slots_[slot_index];
+      slot.key = key;
+      slot.value = value;
+      slot.referenced = false;
+      index_.emplace(key, slot_index);
+    }
+
+    bool Get(const Key& key, Value* value) {
+      base::AutoLock lock(lock_);
+      auto it = index_.find(key);
+      if (it == index_.end())
+        return false;
+      Slot& slot = slots_[it->second];
+      slot.referenced = true;
+      *value = slot.value;
+      return true;
+    }
+
+    void Erase(const Key& key) {
+      base::AutoLock lock(lock_);
+      auto it = index_.find(key);
+      if (it == index_.end())
+        return;
+      Slot& slot = slots_[it->second];
+      slot.referenced = false;
+      slot.value = Value();
+      free_slots_.push_back(it->second);
+      index_.erase(it);
+    }
+
+    void Clear() {
+      base::AutoLock lock(lock_);
+      index_.clear();
+      slots_.clear();
+      free_slots_.clear();
+      hand_ = 0;
+    }
+
+   private:
+    struct Slot {
+      Key key;
+      Value value;
+      bool referenced = false;
+    };
+
+    // Advances the clock hand to the first entry which was not referenced
+    // since the hand last passed it, and frees that entry. Only called when
+    // every slot is in use.
+    size_t Evict() EXCLUSIVE_LOCKS_REQUIRED(lock_) {
+      DCHECK(free_slots_.empty());
+      DCHECK_EQ(slots_.size(), capacity_);
+      while (true) {
+        Slot& slot = slots_[hand_];
+        const size_t slot_index = hand_;
+        hand_ = (hand_ + 1) % slots_.size();
+        if (slot.referenced) {
+          slot.referenced = false;
+          continue;
+        }
+        index_.erase(slot.key);
+        return slot_index;
+      }
+    }
+
+    const size_t capacity_;
+    base::Lock lock_;
+    std::vector<Slot> slots_ GUARDED_BY(lock_);
+    std::vector<size_t> free_slots_ GUARDED_BY(lock_);
+    std::unordered_map<Key, size_t, Hash> index_ GUARDED_BY(lock_);
+    size_t hand_ GUARDED_BY(lock_) = 0;
+  };
+
+  Shard& GetShard(const Key& key) {
+    return *shards_[Hash()(key) % shards_.size()];
+  }
+
+  std::vector<std::unique_ptr<Shard>> shards_;
+};
+
+}  // namespace brave_shields
+
+#endif  // BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_SHARDED_CLOCK_CACHE_H_
@@ -0,0 +1,128 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_shields/browser/sharded_clock_cache.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/strings/string_number_conversions.h"
+#include "base/threading/simple_thread.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace brave_shields {
+
+namespace {
+
+using Cache = ShardedClockCache<std::string, int>;
+
+class CacheUserThread : public base::SimpleThread {
+ public:
+  CacheUserThread(Cache* cache, int id)
+      : base::SimpleThread("CacheUserThread"), cache_(cache), id_(id) {}
+
+  void Run() override {
+    for (int i = 0; i < 1000; ++i) {
+      const std::string key = base::NumberToString((id_ * 1000 + i) % 64);
+      int value;
+      if (!cache_->Get(key, &value))
+        cache_->Put(key, i);
+    }
+  }
+
+ private:
+  Cache* cache_;
+  int id_;
+};
+
+}  // namespace
+
+TEST(ShardedClockCacheTest, EvictsUnreferencedEntries) {
+  Cache cache(3);
+  EXPECT_EQ(1u, cache.shard_count());
+
+  cache.Put("a", 1);
+  cache.Put("b", 2);
+  cache.Put("c", 3);
+
+  int value;
+  ASSERT_TRUE(cache.Get("a", &value));
+  EXPECT_EQ(1, value);
+
+  // "a" was referenced since insertion so it gets a second chance.
+  cache.Put("d", 4);
+  EXPECT_TRUE(cache.Get("a", &value));
+  EXPECT_FALSE(cache.Get("b", &value));
+  EXPECT_TRUE(cache.Get("c", &value));
+  EXPECT_TRUE(cache.Get("d", &value));
+}
+
+TEST(ShardedClockCacheTest, EraseAndReplace) {
+  Cache cache(2);
+
+  cache.Put("a", 1);
+  cache.Put("a", 2);
+  int value;
+  ASSERT_TRUE(cache.Get("a", &value));
+  EXPECT_EQ(2, value);
+
+  cache.Erase("a");
+  EXPECT_FALSE(cache.Get("a", &value));
+
+  // The erased slot is reused without evicting anything.
+  cache.Put("b", 1);
+  cache.Put("c", 1);
+  EXPECT_TRUE(cache.Get("b", &value));
+  EXPECT_TRUE(cache.Get("c", &value));
+
+  cache.Clear();
+  EXPECT_FALSE(cache.Get("b", &value));
+  EXPECT_FALSE(cache.Get("c", &value));
+}
+
+TEST(ShardedClockCacheTest, ShardsLargeCaches) {
+  Cache cache(100);
+  EXPECT_EQ(6u, cache.shard_count());
+
+  for (int i = 0; i < 100; ++i)
+    cache.Put(base::NumberToString(i), i);
+
+  // Entries only compete for space within their own shard, so fill the cache
+  // well past capacity and check that it never holds more than its capacity.
+  for (int i = 100; i < 1000; ++i)
+    cache.Put(base::NumberToString(i), i);
+  size_t present = 0;
+  for (int i = 0; i < 1000; ++i) {
+    int value;
+    if (cache.Get(base::NumberToString(i), &value)) {
+      EXPECT_EQ(i, value);
+      ++present;
+    }
+  }
+  EXPECT_EQ(100u, present);
+}
+
+TEST(ShardedClockCacheTest, ConcurrentAccess) {
+  Cache cache(32);
+
+  std::vector<std::unique_ptr<CacheUserThread>> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.push_back(std::make_unique<CacheUserThread>(&cache, i));
+    threads.back()->Start();
+  }
+  for (auto& thread : threads)
+    thread->Join();
+
+  size_t present = 0;
+  for (int i = 0; i < 64; ++i) {
+    int value;
+    if (cache.Get(base::NumberToString(i), &value))
+      ++present;
+  }
+  EXPECT_LE(present, 32u);
+}
+
+}  // namespace brave_shields
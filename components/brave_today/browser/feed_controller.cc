@@ -14,7 +14,9 @@
 #include "base/barrier_callback.h"
 #include "base/bind.h"
 #include "base/callback_forward.h"
+#include "base/metrics/histogram_macros.h"
 #include "base/one_shot_event.h"
+#include "base/task/thread_pool.h"
 #include "brave/components/api_request_helper/api_request_helper.h"
 #include "brave/components/brave_private_cdn/headers.h"
 #include "brave/components/brave_today/browser/direct_feed_controller.h"
@@ -39,6 +41,25 @@ GURL GetFeedUrl() {
   return feed_url;
 }
 
+FeedItems ParseFeedItemsOnTaskRunner(const std::string& body) {
+  SCOPED_UMA_HISTOGRAM_TIMER("Brave.Today.FeedParseTime");
+  FeedItems feed_items;
+  ParseFeedItems(body, &feed_items);
+  return feed_items;
+}
+
+mojom::FeedPtr BuildFeedOnTaskRunner(
+    FeedItems feed_items,
+    std::unordered_set<std::string> history_hosts,
+    Publishers publishers) {
+  SCOPED_UMA_HISTOGRAM_TIMER("Brave.Today.FeedBuildTime");
+  auto feed = mojom::Feed::New();
+  if (!BuildFeed(feed_items, history_hosts, &publishers, feed.get())) {
+    VLOG(1) << "ParseFeed reported failure.";
+  }
+  return feed;
+}
+
 }  // namespace
 
 FeedController::FeedController(
@@ -94,6 +115,7 @@ void FeedController::EnsureFeedIsUpdating() {
     return;
   }
   is_update_in_progress_ = true;
+  update_generation_ = feed_generation_;
 
   // Fetch publishers via callback
   publishers_controller_->GetOrFetchPublishers(base::BindOnce(
@@ -148,16 +170,17 @@ void FeedController::EnsureFeedIsUpdating() {
                       history_hosts.insert(host);
                     }
                     VLOG(1) << "history hosts # " << history_hosts.size();
-                    // Parse directly to in-memory property
-                    controller->ResetFeed();
-                    std::vector<mojom::FeedItemPtr> feed_items;
-                    if (BuildFeed(all_feed_items, history_hosts, &publishers,
-                                  &controller->current_feed_)) {
-                    } else {
-                      VLOG(1) << "ParseFeed reported failure.";
-                    }
-                    // Let any callbacks know that the data is ready or errored.
-                    controller->NotifyUpdateDone();
+                    // Scoring and shuffling thousands of items is too slow
+                    // for the UI thread.
+                    base::ThreadPool::PostTaskAndReplyWithResult(
+                        FROM_HERE, {base::TaskPriority::USER_VISIBLE},
+                        base::BindOnce(&BuildFeedOnTaskRunner,
+                                       std::move(all_feed_items),
+                                       std::move(history_hosts),
+                                       std::move(publishers)),
+                        base::BindOnce(&FeedController::OnFeedBuilt,
+                                       controller->weak_ptr_factory_
+                                           .GetWeakPtr()));
                   },
                   base::Unretained(controller), std::move(all_feed_items),
                   std::move(publishers));
@@ -232,6 +255,8 @@ void FeedController::UpdateIfRemoteChanged() {
 }
 
 void FeedController::ClearCache() {
+  // Any update which is in flight was started for the feed we are clearing.
+  ++feed_generation_;
   ResetFeed();
 }
 
@@ -244,7 +269,7 @@ void FeedController::FetchCombinedFeed(GetFeedItemsCallback callback) {
   // Handle the response
   auto response_handler = base::BindOnce(
       [](FeedController* controller, GetFeedItemsCallback callback, int status,
-         const std::string& body,
+         std::string body,
          const base::flat_map<std::string, std::string>& headers) {
         std::string etag;
         if (headers.contains(kEtagHeaderKey)) {
@@ -261,9 +286,20 @@ void FeedController::FetchCombinedFeed(GetFeedItemsCallback callback) {
         // Only mark cache time of remote request if
         // parsing was successful
         controller->current_feed_etag_ = etag;
-        FeedItems feed_items;
-        ParseFeedItems(body, &feed_items);
-        std::move(callback).Run(std::move(feed_items));
+        // The feed is several megabytes of JSON, so parse it off the UI
+        // thread.
+        base::ThreadPool::PostTaskAndReplyWithResult(
+            FROM_HERE, {base::TaskPriority::USER_VISIBLE},
+            base::BindOnce(&ParseFeedItemsOnTaskRunner, std::move(body)),
+            base::BindOnce(
+                [](base::WeakPtr<FeedController> controller,
+                   GetFeedItemsCallback callback, FeedItems feed_items) {
+                  if (!controller)
+                    return;
+                  std::move(callback).Run(std::move(feed_items));
+                },
+                controller->weak_ptr_factory_.GetWeakPtr(),
+                std::move(callback)));
       },
       base::Unretained(this), std::move(callback));
   // Send the request
@@ -290,6 +326,21 @@ void FeedController::GetOrFetchFeed(base::OnceClosure callback) {
   EnsureFeedIsUpdating();
 }
 
+void FeedController::OnFeedBuilt(mojom::FeedPtr feed) {
+  // Don't store a feed built from data which was cleared during the update.
+  if (update_generation_ != feed_generation_) {
+    VLOG(1) << "Discarding feed built before the cache was cleared";
+    NotifyUpdateDone();
+    return;
+  }
+  ResetFeed();
+  current_feed_.hash = std::move(feed->hash);
+  current_feed_.pages = std::move(feed->pages);
+  current_feed_.featured_item = std::move(feed->featured_item);
+  // Let any callbacks know that the data is ready or errored.
+  NotifyUpdateDone();
+}
+
 void FeedController::ResetFeed() {
   current_feed_.featured_item = nullptr;
   current_feed_.hash = "";
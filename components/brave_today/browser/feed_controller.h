@@ -6,11 +6,13 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_TODAY_BROWSER_FEED_CONTROLLER_H_
 #define BRAVE_COMPONENTS_BRAVE_TODAY_BROWSER_FEED_CONTROLLER_H_
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include "base/memory/raw_ptr.h"
+#include "base/memory/weak_ptr.h"
 #include "base/one_shot_event.h"
 #include "base/scoped_observation.h"
 #include "brave/components/api_request_helper/api_request_helper.h"
@@ -66,6 +68,7 @@ class FeedController : public PublishersController::Observer {
  private:
   void FetchCombinedFeed(GetFeedItemsCallback callback);
   void GetOrFetchFeed(base::OnceClosure callback);
+  void OnFeedBuilt(mojom::FeedPtr feed);
   void ResetFeed();
   void NotifyUpdateDone();
 
@@ -86,6 +89,12 @@ class FeedController : public PublishersController::Observer {
   mojom::Feed current_feed_;
   std::string current_feed_etag_;
   bool is_update_in_progress_ = false;
+  // Bumped by ClearCache() so that an update which was already in flight
+  // doesn't repopulate the cleared feed.
+  uint64_t feed_generation_ = 0;
+  uint64_t update_generation_ = 0;
+
+  base::WeakPtrFactory<FeedController> weak_ptr_factory_{this};
 };
 
 }  // namespace brave_news
@@ -6,8 +6,10 @@
 #include "brave/components/brave_wallet/browser/json_rpc_service.h"
 
 #include <utility>
+#include <vector>
 
 #include "base/bind.h"
+#include "base/containers/flat_set.h"
 #include "base/environment.h"
 #include "base/json/json_writer.h"
 #include "base/no_destructor.h"
@@ -80,6 +82,16 @@ void ChainIdValidationResponse(
   std::move(callback).Run(success);
 }
 
+// Methods which do not change chain state, so concurrent identical requests
+// can share a response.
+bool IsReadOnlyMethod(const std::string& method) {
+  static const base::NoDestructor<base::flat_set<std::string>> kMethods(
+      base::flat_set<std::string>({"eth_call", "eth_chainId", "eth_getBalance",
+                                   "eth_getCode", kEthBlockNumber,
+                                   kEthGetBlockByNumber}));
+  return kMethods->contains(method);
+}
+
 bool IsChainExist(PrefService* prefs, const std::string& chain_id) {
   std::vector<::brave_wallet::mojom::EthereumChainPtr> custom_chains;
   brave_wallet::GetAllChains(prefs, &custom_chains);
@@ -114,6 +126,8 @@ void JsonRpcService::SetAPIRequestHelperForTesting(
     scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory) {
   api_request_helper_.reset(new api_request_helper::APIRequestHelper(
       GetNetworkTrafficAnnotationTag(), url_loader_factory));
+  // Responses for requests made by the old helper will never arrive.
+  in_flight_requests_.clear();
 }
 
 JsonRpcService::~JsonRpcService() {}
@@ -149,7 +163,9 @@ void JsonRpcService::RequestInternal(const std::string& json_payload,
 
   base::flat_map<std::string, std::string> request_headers;
   std::string id, method, params;
-  if (GetEthJsonRequestInfo(json_payload, nullptr, &method, &params)) {
+  const bool is_eth_request =
+      GetEthJsonRequestInfo(json_payload, nullptr, &method, &params);
+  if (is_eth_request) {
     request_headers["X-Eth-Method"] = method;
     if (method == kEthGetBlockByNumber) {
       std::string cleaned_params;
@@ -167,9 +183,50 @@ void JsonRpcService::RequestInternal(const std::string& json_payload,
   }
   request_headers["x-brave-key"] = brave_key;
 
-  api_request_helper_->Request("POST", network_url, json_payload,
-                               "application/json", auto_retry_on_network_change,
-                               std::move(callback), request_headers);
+  if (!is_eth_request || !IsReadOnlyMethod(method)) {
+    api_request_helper_->Request("POST", network_url, json_payload,
+                                 "application/json",
+                                 auto_retry_on_network_change,
+                                 std::move(callback), request_headers);
+    return;
+  }
+
+  // Identical read-only requests, i.e. the same token balance requested by
+  // several views, are coalesced while a request is in flight.
+  auto key = std::make_pair(network_url, json_payload);
+  auto iter = in_flight_requests_.find(key);
+  if (iter != in_flight_requests_.end()) {
+    iter->second.push_back(std::move(callback));
+    return;
+  }
+  in_flight_requests_[key].push_back(std::move(callback));
+
+  api_request_helper_->Request(
+      "POST", network_url, json_payload, "application/json",
+      auto_retry_on_network_change,
+      base::BindOnce(&JsonRpcService::OnRequestInternal,
+                     weak_ptr_factory_.GetWeakPtr(), network_url,
+                     json_payload),
+      request_headers);
+}
+
+void JsonRpcService::OnRequestInternal(
+    const GURL& network_url,
+    const std::string& json_payload,
+    const int status,
+    const std::string& body,
+    const base::flat_map<std::string, std::string>& headers) {
+  auto iter =
+      in_flight_requests_.find(std::make_pair(network_url, json_payload));
+  if (iter == in_flight_requests_.end())
+    return;
+
+  // Callbacks may issue the same request again, so take them out of the map
+  // before running them.
+  std::vector<RequestCallback> callbacks = std::move(iter->second);
+  in_flight_requests_.erase(iter);
+  for (auto& callback : callbacks)
+    std::move(callback).Run(status, body, headers);
 }
 
 void JsonRpcService::FirePendingRequestCompleted(const std::string& chain_id,
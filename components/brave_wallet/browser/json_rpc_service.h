@@ -365,6 +365,12 @@ class JsonRpcService : public KeyedService, public mojom::JsonRpcService {
                        bool auto_retry_on_network_change,
                        const GURL& network_url,
                        RequestCallback callback);
+  void OnRequestInternal(
+      const GURL& network_url,
+      const std::string& json_payload,
+      const int status,
+      const std::string& body,
+      const base::flat_map<std::string, std::string>& headers);
   void OnEthChainIdValidatedForOrigin(
       mojom::EthereumChainPtr chain,
       const GURL& origin,
@@ -421,6 +427,10 @@ class JsonRpcService : public KeyedService, public mojom::JsonRpcService {
       const base::flat_map<std::string, std::string>& headers);
 
   std::unique_ptr<api_request_helper::APIRequestHelper> api_request_helper_;
+  // <<network_url, json_payload>, callbacks> for read-only requests which are
+  // in flight, so that identical requests share a single round trip.
+  base::flat_map<std::pair<GURL, std::string>, std::vector<RequestCallback>>
+      in_flight_requests_;
   GURL network_url_;
   std::string chain_id_;
   // <chain_id, EthereumChainRequest>
@@ -1213,6 +1213,58 @@ TEST_F(JsonRpcServiceUnitTest, GetERC20TokenBalance) {
   EXPECT_TRUE(callback_called);
 }
 
+TEST_F(JsonRpcServiceUnitTest, CoalesceIdenticalReadOnlyRequests) {
+  size_t request_count = 0;
+  url_loader_factory_.SetInterceptor(base::BindLambdaForTesting(
+      [&](const network::ResourceRequest& request) {
+        ++request_count;
+        url_loader_factory_.ClearResponses();
+        url_loader_factory_.AddResponse(
+            request.url.spec(),
+            "{\"jsonrpc\":\"2.0\",\"id\":1,\"result\":"
+            "\"0x00000000000000000000000000000000000000000000000166e12cfce39a"
+            "0000\"}");
+      }));
+
+  bool callback1_called = false;
+  bool callback2_called = false;
+  bool callback3_called = false;
+  const std::string expected_balance =
+      "0x00000000000000000000000000000000000000000000000166e12cfce39a0000";
+  json_rpc_service_->GetERC20TokenBalance(
+      "0x0d8775f648430679a709e98d2b0cb6250d2887ef",
+      "0x4e02f254184E904300e0775E4b8eeCB1",
+      base::BindOnce(&OnStringResponse, &callback1_called,
+                     mojom::ProviderError::kSuccess, "", expected_balance));
+  json_rpc_service_->GetERC20TokenBalance(
+      "0x0d8775f648430679a709e98d2b0cb6250d2887ef",
+      "0x4e02f254184E904300e0775E4b8eeCB1",
+      base::BindOnce(&OnStringResponse, &callback2_called,
+                     mojom::ProviderError::kSuccess, "", expected_balance));
+  // A different contract is not coalesced.
+  json_rpc_service_->GetERC20TokenBalance(
+      "0x6b175474e89094c44da98b954eedeac495271d0f",
+      "0x4e02f254184E904300e0775E4b8eeCB1",
+      base::BindOnce(&OnStringResponse, &callback3_called,
+                     mojom::ProviderError::kSuccess, "", expected_balance));
+  base::RunLoop().RunUntilIdle();
+  EXPECT_TRUE(callback1_called);
+  EXPECT_TRUE(callback2_called);
+  EXPECT_TRUE(callback3_called);
+  EXPECT_EQ(request_count, 2u);
+
+  // Once the response has arrived the same request goes to the network again.
+  callback1_called = false;
+  json_rpc_service_->GetERC20TokenBalance(
+      "0x0d8775f648430679a709e98d2b0cb6250d2887ef",
+      "0x4e02f254184E904300e0775E4b8eeCB1",
+      base::BindOnce(&OnStringResponse, &callback1_called,
+                     mojom::ProviderError::kSuccess, "", expected_balance));
+  base::RunLoop().RunUntilIdle();
+  EXPECT_TRUE(callback1_called);
+  EXPECT_EQ(request_count, 3u);
+}
+
 TEST_F(JsonRpcServiceUnitTest, GetERC20TokenAllowance) {
   bool callback_called = false;
   SetInterceptor(
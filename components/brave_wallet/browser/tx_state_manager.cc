@@ -5,6 +5,7 @@
 
 #include "brave/components/brave_wallet/browser/tx_state_manager.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "base/json/values_util.h"
@@ -21,6 +22,23 @@ namespace {
 constexpr size_t kMaxConfirmedTxNum = 10;
 constexpr size_t kMaxRejectedTxNum = 10;
 
+bool MatchesStatusAndFrom(const base::Value& value,
+                          absl::optional<mojom::TransactionStatus> status,
+                          const absl::optional<std::string>& from) {
+  if (status) {
+    absl::optional<int> value_status = value.FindIntKey("status");
+    if (!value_status ||
+        static_cast<mojom::TransactionStatus>(*value_status) != *status)
+      return false;
+  }
+  if (from) {
+    const std::string* value_from = value.FindStringKey("from");
+    if (!value_from || *value_from != *from)
+      return false;
+  }
+  return true;
+}
+
 }  // namespace
 
 // static
@@ -136,15 +154,15 @@ std::vector<std::unique_ptr<TxMeta>> TxStateManager::GetTransactionsByStatus(
     return result;
 
   for (const auto it : network_dict->DictItems()) {
+    // Filter on the raw value so that only matching transactions pay for a
+    // full TxMeta deserialization.
+    if (!MatchesStatusAndFrom(it.second, status, from))
+      continue;
     std::unique_ptr<TxMeta> meta = ValueToTxMeta(it.second);
     if (!meta) {
       continue;
     }
-    if (!status.has_value() || meta->status() == *status) {
-      if (from.has_value() && meta->from() != *from)
-        continue;
-      result.push_back(std::move(meta));
-    }
+    result.push_back(std::move(meta));
   }
   return result;
 }
@@ -154,24 +172,46 @@ void TxStateManager::RetireTxByStatus(mojom::TransactionStatus status,
   if (status != mojom::TransactionStatus::Confirmed &&
       status != mojom::TransactionStatus::Rejected)
     return;
-  auto tx_metas = GetTransactionsByStatus(status, absl::nullopt);
-  if (tx_metas.size() > max_num) {
-    TxMeta* oldest_meta = nullptr;
-    for (const auto& tx_meta : tx_metas) {
-      if (!oldest_meta) {
-        oldest_meta = tx_meta.get();
-      } else {
-        if (tx_meta->status() == mojom::TransactionStatus::Confirmed &&
-            tx_meta->confirmed_time() < oldest_meta->confirmed_time()) {
-          oldest_meta = tx_meta.get();
-        } else if (tx_meta->status() == mojom::TransactionStatus::Rejected &&
-                   tx_meta->created_time() < oldest_meta->created_time()) {
-          oldest_meta = tx_meta.get();
-        }
-      }
-    }
-    DeleteTx(oldest_meta->id());
+  const char* time_key = status == mojom::TransactionStatus::Confirmed
+                             ? "confirmed_time"
+                             : "created_time";
+
+  const base::Value* dict = prefs_->GetDictionary(kBraveWalletTransactions);
+  const base::Value* network_dict = dict->FindPath(GetTxPrefPathPrefix());
+  if (!network_dict)
+    return;
+
+  // Only the id and the relevant time of each candidate are needed to find the
+  // oldest transactions, so avoid deserializing whole tx metas.
+  std::vector<std::pair<base::Time, std::string>> candidates;
+  for (const auto it : network_dict->DictItems()) {
+    if (!MatchesStatusAndFrom(it.second, status, absl::nullopt))
+      continue;
+    const base::Value* time_value = it.second.FindKey(time_key);
+    if (!time_value)
+      continue;
+    absl::optional<base::Time> time = base::ValueToTime(time_value);
+    if (!time)
+      continue;
+    candidates.emplace_back(*time, it.first);
   }
+  if (candidates.size() <= max_num)
+    return;
+
+  // Ties keep pref order, so the first of several equally old transactions is
+  // retired first.
+  const size_t retire_num = candidates.size() - max_num;
+  std::stable_sort(candidates.begin(), candidates.end(),
+                   [](const auto& lhs, const auto& rhs) {
+                     return lhs.first < rhs.first;
+                   });
+
+  DictionaryPrefUpdate update(prefs_, kBraveWalletTransactions);
+  base::Value* network_dict_update =
+      update.Get()->FindPath(GetTxPrefPathPrefix());
+  DCHECK(network_dict_update);
+  for (size_t i = 0; i < retire_num; ++i)
+    network_dict_update->RemoveKey(candidates[i].second);
 }
 
 void TxStateManager::AddObserver(TxStateManager::Observer* observer) {
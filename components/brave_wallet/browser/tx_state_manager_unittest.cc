@@ -364,6 +364,35 @@ TEST_F(TxStateManagerUnitTest, RetireOldTxMeta) {
   EXPECT_TRUE(tx_state_manager_->GetTx("3"));
 }
 
+TEST_F(TxStateManagerUnitTest, RetireOldestTxMetaByTime) {
+  prefs_.ClearPref(kBraveWalletTransactions);
+
+  const base::Time now = base::Time::Now();
+  for (size_t i = 0; i < 10; ++i) {
+    EthTxMeta meta;
+    meta.set_id(base::NumberToString(i));
+    meta.set_status(mojom::TransactionStatus::Confirmed);
+    meta.set_confirmed_time(i == 5 ? now - base::Hours(1)
+                                   : now + base::Seconds(i));
+    tx_state_manager_->AddOrUpdateTx(meta);
+  }
+
+  EthTxMeta meta10;
+  meta10.set_id("10");
+  meta10.set_status(mojom::TransactionStatus::Confirmed);
+  meta10.set_confirmed_time(now + base::Seconds(10));
+  tx_state_manager_->AddOrUpdateTx(meta10);
+
+  EXPECT_FALSE(tx_state_manager_->GetTx("5"));
+  EXPECT_TRUE(tx_state_manager_->GetTx("0"));
+  EXPECT_TRUE(tx_state_manager_->GetTx("10"));
+  EXPECT_EQ(tx_state_manager_
+                ->GetTransactionsByStatus(mojom::TransactionStatus::Confirmed,
+                                          absl::nullopt)
+                .size(),
+            10u);
+}
+
 TEST_F(TxStateManagerUnitTest, Observer) {
   TestTxStateManagerObserver observer;
   tx_state_manager_->AddObserver(&observer);
@@ -5,6 +5,8 @@
 
 #include "brave/components/debounce/browser/debounce_component_installer.h"
 
+#include <iterator>
+#include <map>
 #include <memory>
 #include <utility>
 
@@ -55,29 +57,59 @@ void DebounceComponentInstaller::OnDATFileDataReady(
   }
   rules_.clear();
   host_cache_.clear();
+  rule_index_.clear();
+  generic_rule_indices_.clear();
   std::vector<std::string> hosts;
+  std::map<std::string, std::vector<size_t>> rule_index;
   base::JSONValueConverter<DebounceRule> converter;
   for (base::Value& it : root->GetList()) {
     std::unique_ptr<DebounceRule> rule = std::make_unique<DebounceRule>();
     if (!converter.Convert(it, rule.get()))
       continue;
+    const size_t rule_index_in_list = rules_.size();
+    base::flat_set<std::string> rule_domains;
+    bool is_generic = false;
     for (const URLPattern& pattern : rule->include_pattern_set()) {
+      std::string etldp1;
       if (!pattern.host().empty()) {
-        std::string etldp1 =
-            net::registry_controlled_domains::GetDomainAndRegistry(
-                pattern.host(),
-                net::registry_controlled_domains::PrivateRegistryFilter::
-                    INCLUDE_PRIVATE_REGISTRIES);
-        hosts.push_back(std::move(etldp1));
+        etldp1 = net::registry_controlled_domains::GetDomainAndRegistry(
+            pattern.host(),
+            net::registry_controlled_domains::PrivateRegistryFilter::
+                INCLUDE_PRIVATE_REGISTRIES);
+        hosts.push_back(etldp1);
       }
+      // Patterns without a registrable domain, such as those matching all
+      // hosts or every subdomain of a public suffix, can match URLs on any
+      // eTLD+1.
+      if (etldp1.empty())
+        is_generic = true;
+      else
+        rule_domains.insert(std::move(etldp1));
+    }
+    if (is_generic) {
+      generic_rule_indices_.push_back(rule_index_in_list);
+    } else {
+      for (const std::string& domain : rule_domains)
+        rule_index[domain].push_back(rule_index_in_list);
     }
     rules_.push_back(std::move(rule));
   }
   host_cache_ = std::move(hosts);
+  rule_index_ = base::flat_map<std::string, std::vector<size_t>>(
+      std::make_move_iterator(rule_index.begin()),
+      std::make_move_iterator(rule_index.end()));
   for (Observer& observer : observers_)
     observer.OnRulesReady(this);
 }
 
+base::span<const size_t> DebounceComponentInstaller::GetRuleIndicesForDomain(
+    const std::string& etldp1) const {
+  auto it = rule_index_.find(etldp1);
+  if (it == rule_index_.end())
+    return {};
+  return it->second;
+}
+
 void DebounceComponentInstaller::OnComponentReady(
     const std::string& component_id,
     const base::FilePath& install_dir,
@@ -10,7 +10,9 @@
 #include <string>
 #include <vector>
 
+#include "base/containers/flat_map.h"
 #include "base/containers/flat_set.h"
+#include "base/containers/span.h"
 #include "base/files/file_path.h"
 #include "base/json/json_value_converter.h"
 #include "base/memory/weak_ptr.h"
@@ -44,6 +46,14 @@ class DebounceComponentInstaller
     return rules_;
   }
   const base::flat_set<std::string>& host_cache() const { return host_cache_; }
+  // Returns the sorted indices into rules() of the rules which have an include
+  // pattern on the given eTLD+1. Rules in generic_rule_indices() may apply to
+  // URLs on any eTLD+1 as well.
+  base::span<const size_t> GetRuleIndicesForDomain(
+      const std::string& etldp1) const;
+  base::span<const size_t> generic_rule_indices() const {
+    return generic_rule_indices_;
+  }
 
   // implementation of brave_component_updater::LocalDataFilesObserver
   void OnComponentReady(const std::string& component_id,
@@ -71,6 +81,11 @@ class DebounceComponentInstaller
   base::ObserverList<Observer> observers_;
   std::vector<std::unique_ptr<DebounceRule>> rules_;
   base::flat_set<std::string> host_cache_;
+  // Indices of the rules which have an include pattern on a given eTLD+1.
+  base::flat_map<std::string, std::vector<size_t>> rule_index_;
+  // Indices of the rules which have an include pattern that isn't tied to one
+  // eTLD+1, e.g. one matching all hosts. These are checked for every URL.
+  std::vector<size_t> generic_rule_indices_;
   base::FilePath resource_dir_;
 
   base::WeakPtrFactory<DebounceComponentInstaller> weak_factory_{this};
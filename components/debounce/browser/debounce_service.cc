@@ -5,11 +5,13 @@
 
 #include "brave/components/debounce/browser/debounce_service.h"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include "base/containers/contains.h"
+#include "base/containers/span.h"
 #include "base/containers/flat_set.h"
 #include "base/logging.h"
 #include "brave/components/debounce/browser/debounce_component_installer.h"
@@ -46,13 +48,43 @@ bool DebounceService::Debounce(const GURL& original_url,
   // one rule applies, the URL is changed to the debounced URL and we continue
   // to apply the rest of the rules to the new URL. Previously checked rules are
   // not reapplied; i.e. we never restart the loop.
-  for (const std::unique_ptr<DebounceRule>& rule : rules) {
-    if (rule->Apply(current_url, final_url)) {
-      if (current_url != *final_url) {
-        changed = true;
-        current_url = *final_url;
-      }
+  //
+  // Only rules which have an include pattern on the eTLD+1 of the current URL
+  // (or one not tied to any eTLD+1) can apply, so the rest are skipped without
+  // matching their patterns. Both lists are sorted, so they are merged as they
+  // are walked to keep the rules in file order.
+  base::span<const size_t> domain_rule_indices =
+      component_installer_->GetRuleIndicesForDomain(etldp1);
+  const base::span<const size_t> generic_rule_indices =
+      component_installer_->generic_rule_indices();
+  auto next_domain_rule = domain_rule_indices.begin();
+  auto next_generic_rule = generic_rule_indices.begin();
+  while (next_domain_rule != domain_rule_indices.end() ||
+         next_generic_rule != generic_rule_indices.end()) {
+    size_t rule_index;
+    if (next_generic_rule == generic_rule_indices.end() ||
+        (next_domain_rule != domain_rule_indices.end() &&
+         *next_domain_rule < *next_generic_rule)) {
+      rule_index = *next_domain_rule++;
+    } else {
+      rule_index = *next_generic_rule++;
     }
+    if (!rules[rule_index]->Apply(current_url, final_url) ||
+        current_url == *final_url) {
+      continue;
+    }
+    changed = true;
+    current_url = *final_url;
+    // The debounced URL may be on a different site, whose rules are only
+    // looked at from the position of the rule which just applied. Generic
+    // rules are already past that position.
+    domain_rule_indices = component_installer_->GetRuleIndicesForDomain(
+        net::registry_controlled_domains::GetDomainAndRegistry(
+            current_url,
+            net::registry_controlled_domains::PrivateRegistryFilter::
+                INCLUDE_PRIVATE_REGISTRIES));
+    next_domain_rule = std::upper_bound(domain_rule_indices.begin(),
+                                        domain_rule_indices.end(), rule_index);
   }
   return changed;
 }